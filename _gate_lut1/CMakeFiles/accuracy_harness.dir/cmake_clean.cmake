@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/accuracy_harness.dir/bench/accuracy.cpp.o"
+  "CMakeFiles/accuracy_harness.dir/bench/accuracy.cpp.o.d"
+  "accuracy_harness"
+  "accuracy_harness.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/accuracy_harness.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
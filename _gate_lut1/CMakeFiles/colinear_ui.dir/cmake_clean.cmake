@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/colinear_ui.dir/functions.cpp.o"
+  "CMakeFiles/colinear_ui.dir/functions.cpp.o.d"
+  "libcolinear_ui.a"
+  "libcolinear_ui.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/colinear_ui.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
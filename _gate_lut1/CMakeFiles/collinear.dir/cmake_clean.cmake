@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/collinear.dir/main.cpp.o"
+  "CMakeFiles/collinear.dir/main.cpp.o.d"
+  "collinear"
+  "collinear.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/collinear.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fast_math_checks.dir/tests/fast_math_checks.cpp.o"
+  "CMakeFiles/fast_math_checks.dir/tests/fast_math_checks.cpp.o.d"
+  "fast_math_checks"
+  "fast_math_checks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fast_math_checks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
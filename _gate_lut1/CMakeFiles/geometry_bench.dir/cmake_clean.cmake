@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geometry_bench.dir/bench/geometry_bench.cpp.o"
+  "CMakeFiles/geometry_bench.dir/bench/geometry_bench.cpp.o.d"
+  "geometry_bench"
+  "geometry_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geometry_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
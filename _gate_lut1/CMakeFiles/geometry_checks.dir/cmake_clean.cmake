@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geometry_checks.dir/tests/geometry_checks.cpp.o"
+  "CMakeFiles/geometry_checks.dir/tests/geometry_checks.cpp.o.d"
+  "geometry_checks"
+  "geometry_checks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geometry_checks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_checks.dir/tests/io_checks.cpp.o"
+  "CMakeFiles/io_checks.dir/tests/io_checks.cpp.o.d"
+  "io_checks"
+  "io_checks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_checks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ring_checks.dir/tests/ring_checks.cpp.o"
+  "CMakeFiles/ring_checks.dir/tests/ring_checks.cpp.o.d"
+  "ring_checks"
+  "ring_checks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ring_checks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/roundtrip_checks.dir/tests/roundtrip_checks.cpp.o"
+  "CMakeFiles/roundtrip_checks.dir/tests/roundtrip_checks.cpp.o.d"
+  "roundtrip_checks"
+  "roundtrip_checks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/roundtrip_checks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
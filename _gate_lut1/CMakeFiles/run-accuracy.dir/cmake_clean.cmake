@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run-accuracy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run-accuracy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/server_checks.dir/tests/server_checks.cpp.o"
+  "CMakeFiles/server_checks.dir/tests/server_checks.cpp.o.d"
+  "server_checks"
+  "server_checks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/server_checks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wcet_harness.dir/bench/wcet.cpp.o"
+  "CMakeFiles/wcet_harness.dir/bench/wcet.cpp.o.d"
+  "wcet_harness"
+  "wcet_harness.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wcet_harness.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
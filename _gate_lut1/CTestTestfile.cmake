@@ -0,0 +1,28 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_lut1
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(geometry "/root/repo/_gate_lut1/geometry_checks")
+set_tests_properties(geometry PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;261;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(round-trip "/root/repo/_gate_lut1/roundtrip_checks")
+set_tests_properties(round-trip PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;265;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(io "/root/repo/_gate_lut1/io_checks" "/root/repo/_gate_lut1")
+set_tests_properties(io PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;269;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(server "/root/repo/_gate_lut1/server_checks" "/root/repo/_gate_lut1")
+set_tests_properties(server PROPERTIES  TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;273;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(ring "/root/repo/_gate_lut1/ring_checks")
+set_tests_properties(ring PROPERTIES  TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;281;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(fast-math "/root/repo/_gate_lut1/fast_math_checks")
+set_tests_properties(fast-math PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;293;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(cli-stream "/usr/bin/cmake" "-DCOLLINEAR=/root/repo/_gate_lut1/collinear" "-DWORK_DIR=/root/repo/_gate_lut1" "-P" "/root/repo/tests/StreamCheck.cmake")
+set_tests_properties(cli-stream PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;295;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(accuracy-realtime "/root/repo/_gate_lut1/accuracy_harness" "--points" "4096" "--min-time" "0" "--check" "--filter" "/realtime/random" "--tolerance" "1e-12")
+set_tests_properties(accuracy-realtime PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;312;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(bench-geometry "/root/repo/_gate_lut1/geometry_bench" "--points" "1024" "--min-time" "0")
+set_tests_properties(bench-geometry PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;315;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(bench-parallel "/root/repo/_gate_lut1/parallel_scaling" "4096" "2")
+set_tests_properties(bench-parallel PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;316;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(bench-wcet "/root/repo/_gate_lut1/wcet_harness" "--samples" "1000")
+set_tests_properties(bench-wcet PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;318;add_test;/root/repo/CMakeLists.txt;0;")
@@ -0,0 +1,637 @@
+// ============================================
+// Accuracy vs. Speed Harness
+// ============================================
+// Runs every curve backend against a double-precision reference over
+// randomized and adversarial inputs and reports, per backend and input
+// class: max and mean absolute error, max ULP distance, results whose
+// finiteness differs from the reference, and ns/point. A closing summary
+// names the fastest backend of each family within --tolerance.
+//
+// The reference is calculateColinearPoint() / ..WithCurvature() with libm
+// sin/cos, re-implemented here from the same rules so that a
+// COLINEAR_TRIG_LUT build is measured against libm and not against
+// itself. Absolute error is the larger of |dx| and |dy|; ULP distance is
+// the larger of the two ordered-bit distances, which is large near zero
+// even when the absolute error is tiny.
+//
+// Poses come in runs of RUN_LENGTH sharing position, heading and radius
+// with evenly spaced dlead, so the incremental backends (the
+// sampleColinearPointsUniform() recurrence and ArcFollower) see the same
+// inputs as the per-pose ones.
+//
+// --dump FILE writes the raw float64 x and y outputs of every backend that
+// runs, in run order. Builds of the same source with different compiler
+// flags produce identical double-precision results exactly when their
+// dump files match. --compare FILE reads a dump written by another build
+// of the same harness and options and prints, to stderr, how many values
+// differ and by how much (the perf-report target uses both).
+//
+// --check turns the run into a test: the exit status is 1 if any selected
+// row has an error above --tolerance or a finiteness mismatch, or if the
+// filter selects nothing (ctest runs it this way).
+//
+// Usage: accuracy_harness [--filter TEXT] [--points N] [--min-time SECONDS]
+//                         [--tolerance ABS] [--csv] [--dump FILE] [--compare FILE]
+//                         [--check]
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "../headerFiLES/cache.hpp"
+#include "../headerFiLES/fixed16.hpp"
+#include "../headerFiLES/follower.hpp"
+#include "../headerFiLES/realtime.hpp"
+#include "../headerFiLES/simd.hpp"
+
+// Poses per run of shared position / heading / radius
+const std::size_t RUN_LENGTH = 64;
+
+// ============================================
+// Input Classes
+// ============================================
+struct PoseSet {
+    std::string name;
+    std::vector<double> x, y, theta, dlead, radius, curvature;
+    std::vector<double> dleadStep;  // Per run: dlead[i + 1] - dlead[i]
+};
+
+enum class InputClass {
+    Random,        // |theta| <= pi, |dlead| <= 10, radius in [0.1, 10]
+    HugeTheta,     // |theta| log-uniform in [1e3, 1e15]
+    MinDlead,      // runs crossing |dlead| = MIN_DLEAD
+    MaxDlead,      // runs crossing |dlead| = MAX_DLEAD, large arc angles
+    NearEpsilon,   // |curvature| around EPSILON (straight-line switch), radius ~ 1e9
+    TinyRadius,    // |radius| around EPSILON (default-radius fallback)
+    HugeCurvature  // |curvature| above 1 / EPSILON with a small dlead (fallback on the curvature path)
+};
+
+static PoseSet makePoses(InputClass input, std::size_t count, std::uint64_t seed) {
+    static const char *names[] = {"random", "huge-theta", "min-dlead", "max-dlead", "near-epsilon", "tiny-radius",
+                                  "huge-curvature"};
+    PoseSet set;
+    set.name = names[static_cast<int>(input)];
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> pos(-100.0, 100.0);
+    std::uniform_real_distribution<double> ang(-M_PI, M_PI);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    for (std::vector<double> *column : {&set.x, &set.y, &set.theta, &set.dlead, &set.radius, &set.curvature}) {
+        column->resize(count);
+    }
+    set.dleadStep.resize((count + RUN_LENGTH - 1) / RUN_LENGTH);
+
+    for (std::size_t run = 0; run * RUN_LENGTH < count; ++run) {
+        double sign = unit(rng) < 0.5 ? -1.0 : 1.0;
+        double x = pos(rng);
+        double y = pos(rng);
+        double theta = ang(rng);
+        double radius = 0.1 + 10.0 * unit(rng);
+        double start = sign * 10.0 * unit(rng);
+        double step = -sign * 20.0 * unit(rng) / static_cast<double>(RUN_LENGTH);
+        double curvature = 0.0;
+        bool curvatureSet = false;
+        switch (input) {
+            case InputClass::Random:
+                break;
+            case InputClass::HugeTheta:
+                theta = sign * std::pow(10.0, 3.0 + 12.0 * unit(rng));
+                break;
+            case InputClass::MinDlead:
+                start = sign * MIN_DLEAD * 0.5;
+                step = sign * MIN_DLEAD * 2.0 / static_cast<double>(RUN_LENGTH);
+                break;
+            case InputClass::MaxDlead:
+                start = sign * MAX_DLEAD * (1.0 - 1e-6 * unit(rng));
+                step = sign * MAX_DLEAD * 2e-6 / static_cast<double>(RUN_LENGTH);
+                break;
+            case InputClass::NearEpsilon:
+                curvature = sign * EPSILON * (0.5 + unit(rng));
+                radius = 1.0 / std::abs(curvature);
+                curvatureSet = true;
+                break;
+            case InputClass::TinyRadius:
+                radius = EPSILON * 2.0 * unit(rng);
+                break;
+            case InputClass::HugeCurvature:
+                // 1 / curvature < EPSILON; a small dlead keeps dlead / radius in SIMD range
+                curvature = sign * (2.0 + 1e3 * unit(rng)) / EPSILON;
+                radius = 1.0 / std::abs(curvature);
+                curvatureSet = true;
+                start = sign * MIN_DLEAD * (2.0 + 8.0 * unit(rng));
+                step = sign * MIN_DLEAD * 10.0 / static_cast<double>(RUN_LENGTH);
+                break;
+        }
+        if (!curvatureSet) {
+            curvature = unit(rng) < 0.5 ? -1.0 / radius : 1.0 / radius;
+        }
+        set.dleadStep[run] = step;
+        for (std::size_t k = 0; k < RUN_LENGTH && run * RUN_LENGTH + k < count; ++k) {
+            std::size_t i = run * RUN_LENGTH + k;
+            set.x[i] = x;
+            set.y[i] = y;
+            set.theta[i] = theta;
+            set.dlead[i] = start + static_cast<double>(k) * step;
+            set.radius[i] = radius;
+            set.curvature[i] = curvature;
+        }
+    }
+    return set;
+}
+
+// ============================================
+// Reference
+// ============================================
+/**
+ * @brief calculateColinearPoint() rules on any sincos
+ */
+template <typename SinCos>
+static Point ruledPoint(double x, double y, double theta, double dlead, double radius, SinCos sinCosFn) {
+    if (std::abs(dlead) < MIN_DLEAD) {
+        return Point{x, y};
+    }
+    dlead = dlead > MAX_DLEAD ? MAX_DLEAD : dlead < -MAX_DLEAD ? -MAX_DLEAD : dlead;
+    radius = std::abs(radius) < EPSILON ? DEFAULT_CURVATURE_RADIUS : std::abs(radius);
+    PoseContext pose;
+    pose.x = x;
+    pose.y = y;
+    sinCosFn(theta, pose.sinTheta, pose.cosTheta);
+    double sinPhi;
+    double cosPhi;
+    sinCosFn(dlead / radius, sinPhi, cosPhi);
+    return arcPointFromTrig(pose, radius, sinPhi, cosPhi);
+}
+
+template <typename SinCos>
+static Point ruledPointWithCurvature(double x, double y, double theta, double dlead, double curvature,
+                                     SinCos sinCosFn) {
+    if (std::abs(curvature) < EPSILON) {
+        double sinTheta;
+        double cosTheta;
+        sinCosFn(theta, sinTheta, cosTheta);
+        return Point{x + dlead * cosTheta, y + dlead * sinTheta};
+    }
+    return ruledPoint(x, y, theta, curvature < 0.0 ? -dlead : dlead, 1.0 / std::abs(curvature), sinCosFn);
+}
+
+static void libmSinCos(double angle, double &s, double &c) {
+    sinCos(angle, s, c);
+}
+
+// ============================================
+// Error Metrics
+// ============================================
+static std::uint64_t ulpDistance(double a, double b) {
+    if (a == b) {
+        return 0;  // Includes +0 / -0
+    }
+    std::int64_t ia;
+    std::int64_t ib;
+    std::memcpy(&ia, &a, sizeof(double));
+    std::memcpy(&ib, &b, sizeof(double));
+    // Map the sign-magnitude bit patterns onto a monotonic integer line
+    ia = ia < 0 ? std::numeric_limits<std::int64_t>::min() - ia : ia;
+    ib = ib < 0 ? std::numeric_limits<std::int64_t>::min() - ib : ib;
+    return ia > ib ? static_cast<std::uint64_t>(ia) - static_cast<std::uint64_t>(ib)
+                   : static_cast<std::uint64_t>(ib) - static_cast<std::uint64_t>(ia);
+}
+
+struct ErrorStats {
+    double maxAbs = 0.0;
+    double meanAbs = 0.0;
+    std::uint64_t maxUlp = 0;
+    std::size_t nonFinite = 0;  // Finiteness differs from the reference (excluded from the other columns)
+};
+
+static ErrorStats compare(const std::vector<double> &refX, const std::vector<double> &refY,
+                          const std::vector<double> &outX, const std::vector<double> &outY) {
+    ErrorStats stats;
+    double sum = 0.0;
+    std::size_t counted = 0;
+    for (std::size_t i = 0; i < refX.size(); ++i) {
+        bool refFinite = std::isfinite(refX[i]) && std::isfinite(refY[i]);
+        bool outFinite = std::isfinite(outX[i]) && std::isfinite(outY[i]);
+        if (refFinite != outFinite) {
+            ++stats.nonFinite;
+            continue;
+        }
+        if (!refFinite) {
+            continue;
+        }
+        double err = std::max(std::abs(outX[i] - refX[i]), std::abs(outY[i] - refY[i]));
+        stats.maxAbs = std::max(stats.maxAbs, err);
+        stats.maxUlp = std::max(stats.maxUlp, std::max(ulpDistance(outX[i], refX[i]), ulpDistance(outY[i], refY[i])));
+        sum += err;
+        ++counted;
+    }
+    stats.meanAbs = counted == 0 ? 0.0 : sum / static_cast<double>(counted);
+    return stats;
+}
+
+// ============================================
+// Backends
+// ============================================
+enum class Family {
+    Arc,        // x, y, theta, dlead, radius
+    Curvature   // x, y, theta, dlead, curvature
+};
+
+struct Backend {
+    std::string name;
+    Family family;
+    std::function<void(const PoseSet &, double *, double *)> run;
+};
+
+static std::vector<Backend> makeBackends() {
+    std::vector<Backend> backends;
+    std::string trig = trigBackendInfo().name;
+
+    backends.push_back({"scalar[" + trig + "]", Family::Arc, [](const PoseSet &s, double *ox, double *oy) {
+        calculateColinearPointBatch(s.x.data(), s.y.data(), s.theta.data(), s.dlead.data(), s.radius.data(),
+                                    s.x.size(), ox, oy);
+    }});
+    backends.push_back({"scalar[" + trig + "]", Family::Curvature, [](const PoseSet &s, double *ox, double *oy) {
+        calculateColinearPointWithCurvatureBatch(s.x.data(), s.y.data(), s.theta.data(), s.dlead.data(),
+                                                 s.curvature.data(), s.x.size(), ox, oy);
+    }});
+
+    // The table backend at run time, whatever COLINEAR_TRIG_LUT says
+    backends.push_back({"lut-linear-256", Family::Arc, [](const PoseSet &s, double *ox, double *oy) {
+        for (std::size_t i = 0; i < s.x.size(); ++i) {
+            Point p = ruledPoint(s.x[i], s.y[i], s.theta[i], s.dlead[i], s.radius[i], lutSinCos<double, 256, 1>);
+            ox[i] = p.x;
+            oy[i] = p.y;
+        }
+    }});
+    backends.push_back({"lut-quadratic-256", Family::Arc, [](const PoseSet &s, double *ox, double *oy) {
+        for (std::size_t i = 0; i < s.x.size(); ++i) {
+            Point p = ruledPoint(s.x[i], s.y[i], s.theta[i], s.dlead[i], s.radius[i], lutSinCos<double, 256, 2>);
+            ox[i] = p.x;
+            oy[i] = p.y;
+        }
+    }});
+
+    for (SimdLevel level : {SimdLevel::Avx2, SimdLevel::Avx512}) {
+        if (static_cast<int>(level) > static_cast<int>(activeSimdLevel())) {
+            continue;
+        }
+        std::string name = std::string("simd-") + simdLevelName(level);
+        backends.push_back({name, Family::Arc, [level](const PoseSet &s, double *ox, double *oy) {
+            calculateColinearPointBatchSimd(s.x.data(), s.y.data(), s.theta.data(), s.dlead.data(),
+                                            s.radius.data(), s.x.size(), ox, oy, level);
+        }});
+        backends.push_back({name, Family::Curvature, [level](const PoseSet &s, double *ox, double *oy) {
+            calculateColinearPointWithCurvatureBatchSimd(s.x.data(), s.y.data(), s.theta.data(), s.dlead.data(),
+                                                         s.curvature.data(), s.x.size(), ox, oy, level);
+        }});
+    }
+
+    backends.push_back({"float32", Family::Arc, [](const PoseSet &s, double *ox, double *oy) {
+        for (std::size_t i = 0; i < s.x.size(); ++i) {
+            BasicPoint<float> p = basicColinearPoint(
+                makeBasicPoseContext<float>(static_cast<float>(s.x[i]), static_cast<float>(s.y[i]),
+                                            static_cast<float>(s.theta[i])),
+                static_cast<float>(s.dlead[i]), static_cast<float>(s.radius[i]));
+            ox[i] = p.x;
+            oy[i] = p.y;
+        }
+    }});
+    backends.push_back({"float32", Family::Curvature, [](const PoseSet &s, double *ox, double *oy) {
+        for (std::size_t i = 0; i < s.x.size(); ++i) {
+            BasicPoint<float> p = basicColinearPointWithCurvature<float>(
+                static_cast<float>(s.x[i]), static_cast<float>(s.y[i]), static_cast<float>(s.theta[i]),
+                static_cast<float>(s.dlead[i]), static_cast<float>(s.curvature[i]));
+            ox[i] = p.x;
+            oy[i] = p.y;
+        }
+    }});
+
+    // Q16.16 saturates outside +-32768, which the adversarial classes leave on purpose
+    backends.push_back({"fixed16", Family::Arc, [](const PoseSet &s, double *ox, double *oy) {
+        for (std::size_t i = 0; i < s.x.size(); ++i) {
+            BasicPoint<Fixed16> p = basicColinearPoint(
+                makeBasicPoseContext<Fixed16>(Fixed16(s.x[i]), Fixed16(s.y[i]), Fixed16(s.theta[i])),
+                Fixed16(s.dlead[i]), Fixed16(s.radius[i]));
+            ox[i] = p.x.toDouble();
+            oy[i] = p.y.toDouble();
+        }
+    }});
+
+    backends.push_back({"realtime", Family::Arc, [](const PoseSet &s, double *ox, double *oy) {
+        rtColinearPointBatch(s.x.data(), s.y.data(), s.theta.data(), s.dlead.data(), s.radius.data(), s.x.size(),
+                             ox, oy);
+    }});
+    backends.push_back({"realtime", Family::Curvature, [](const PoseSet &s, double *ox, double *oy) {
+        for (std::size_t i = 0; i < s.x.size(); ++i) {
+            Point p = rtColinearPointWithCurvature(s.x[i], s.y[i], s.theta[i], s.dlead[i], s.curvature[i]);
+            ox[i] = p.x;
+            oy[i] = p.y;
+        }
+    }});
+
+    // A fresh cache per pass, so every pass pays its misses
+    backends.push_back({"cache", Family::Arc, [](const PoseSet &s, double *ox, double *oy) {
+        ColinearPointCache cache;
+        cachedColinearPointBatch(cache, s.x.data(), s.y.data(), s.theta.data(), s.dlead.data(), s.radius.data(),
+                                 s.x.size(), ox, oy);
+    }});
+    backends.push_back({"cache", Family::Curvature, [](const PoseSet &s, double *ox, double *oy) {
+        ColinearPointCache cache;
+        cachedColinearPointWithCurvatureBatch(cache, s.x.data(), s.y.data(), s.theta.data(), s.dlead.data(),
+                                              s.curvature.data(), s.x.size(), ox, oy);
+    }});
+
+    // Incremental recurrences along each run
+    backends.push_back({"recurrence-uniform", Family::Arc, [](const PoseSet &s, double *ox, double *oy) {
+        Point run[RUN_LENGTH];
+        for (std::size_t begin = 0; begin < s.x.size(); begin += RUN_LENGTH) {
+            std::size_t n = std::min(RUN_LENGTH, s.x.size() - begin);
+            sampleColinearPointsUniform(makePoseContext(s.x[begin], s.y[begin], s.theta[begin]), s.dlead[begin],
+                                        s.dleadStep[begin / RUN_LENGTH], n, s.radius[begin], run);
+            for (std::size_t k = 0; k < n; ++k) {
+                ox[begin + k] = run[k].x;
+                oy[begin + k] = run[k].y;
+            }
+        }
+    }});
+    backends.push_back({"arc-follower", Family::Arc, [](const PoseSet &s, double *ox, double *oy) {
+        ArcFollower follower;
+        for (std::size_t begin = 0; begin < s.x.size(); begin += RUN_LENGTH) {
+            std::size_t n = std::min(RUN_LENGTH, s.x.size() - begin);
+            PoseContext pose = makePoseContext(s.x[begin], s.y[begin], s.theta[begin]);
+            for (std::size_t k = 0; k < n; ++k) {
+                Point p = follower.update(pose, s.dlead[begin + k], s.radius[begin + k]);
+                ox[begin + k] = p.x;
+                oy[begin + k] = p.y;
+            }
+        }
+    }});
+    return backends;
+}
+
+// ============================================
+// Harness
+// ============================================
+struct Options {
+    std::string filter;
+    std::size_t points = 1 << 16;
+    double minTime = 0.1;
+    double tolerance = 1e-9;
+    bool csv = false;
+    std::string dumpPath;
+    std::string comparePath;
+    bool check = false;
+};
+
+/**
+ * @brief Best-of-passes ns/point of one backend on one set
+ */
+static double timeBackend(const Options &options, const Backend &backend, const PoseSet &set,
+                          std::vector<double> &outX, std::vector<double> &outY) {
+    double best = 1e30;
+    double total = 0.0;
+    int passes = 0;
+    while (total < options.minTime || passes < 3) {
+        auto t0 = std::chrono::steady_clock::now();
+        backend.run(set, outX.data(), outY.data());
+        auto t1 = std::chrono::steady_clock::now();
+        double seconds = std::chrono::duration<double>(t1 - t0).count();
+        best = std::min(best, seconds);
+        total += seconds;
+        ++passes;
+    }
+    return best * 1e9 / static_cast<double>(set.x.size());
+}
+
+static bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--csv") {
+            options.csv = true;
+        } else if (arg == "--filter" && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if (arg == "--points" && i + 1 < argc) {
+            options.points = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--min-time" && i + 1 < argc) {
+            options.minTime = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--tolerance" && i + 1 < argc) {
+            options.tolerance = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--dump" && i + 1 < argc) {
+            options.dumpPath = argv[++i];
+        } else if (arg == "--compare" && i + 1 < argc) {
+            options.comparePath = argv[++i];
+        } else if (arg == "--check") {
+            options.check = true;
+        } else {
+            std::fprintf(stderr,
+                         "Usage: %s [--filter TEXT] [--points N] [--min-time SECONDS] [--tolerance ABS] [--csv] "
+                         "[--dump FILE] [--compare FILE] [--check]\n",
+                         argv[0]);
+            return false;
+        }
+    }
+    return options.points > 0;
+}
+
+/**
+ * @brief Differences between this run's outputs and another build's dump
+ */
+struct DumpComparison {
+    std::size_t values = 0;
+    std::size_t differing = 0;   // Not bit-identical (NaN vs NaN counts as equal)
+    std::size_t nonFinite = 0;   // Finiteness differs
+    double maxAbs = 0.0;
+    std::uint64_t maxUlp = 0;
+    std::string worst;           // Row with the largest absolute difference
+    bool shortFile = false;
+
+    void add(const std::string &row, const double *current, std::FILE *baseline, std::size_t count) {
+        std::vector<double> other(count);
+        if (std::fread(other.data(), sizeof(double), count, baseline) != count) {
+            shortFile = true;
+            return;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            ++values;
+            double a = current[i];
+            double b = other[i];
+            if (std::memcmp(&a, &b, sizeof(double)) == 0 || (std::isnan(a) && std::isnan(b))) {
+                continue;
+            }
+            ++differing;
+            if (std::isfinite(a) != std::isfinite(b)) {
+                ++nonFinite;
+                continue;
+            }
+            double diff = std::abs(a - b);
+            if (diff > maxAbs) {
+                maxAbs = diff;
+                worst = row;
+            }
+            maxUlp = std::max(maxUlp, ulpDistance(a, b));
+        }
+    }
+};
+
+struct Summary {
+    double worstAbs = 0.0;
+    std::size_t nonFinite = 0;
+    double totalNs = 0.0;
+    int classes = 0;
+};
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+
+    if (options.csv) {
+        std::printf("family,backend,input,max_abs,mean_abs,max_ulp,nonfinite,ns_per_point\n");
+    } else {
+        std::printf("points=%zu simd=%s trig=%s tolerance=%.3g\n", options.points,
+                    simdLevelName(activeSimdLevel()), trigBackendInfo().name, options.tolerance);
+        std::printf("%-44s %11s %11s %12s %9s %10s\n", "family/backend/input", "max abs", "mean abs", "max ulp",
+                    "nonfinite", "ns/point");
+    }
+
+    const std::vector<Backend> backends = makeBackends();
+    std::vector<Summary> summaries(backends.size());
+    std::vector<double> refX(options.points), refY(options.points);
+    std::vector<double> outX(options.points), outY(options.points);
+    std::FILE *dump = nullptr;
+    if (!options.dumpPath.empty()) {
+        dump = std::fopen(options.dumpPath.c_str(), "wb");
+        if (!dump) {
+            std::fprintf(stderr, "Cannot write %s\n", options.dumpPath.c_str());
+            return 1;
+        }
+    }
+    std::FILE *baseline = nullptr;
+    DumpComparison comparison;
+    if (!options.comparePath.empty()) {
+        baseline = std::fopen(options.comparePath.c_str(), "rb");
+        if (!baseline) {
+            std::fprintf(stderr, "Cannot read %s\n", options.comparePath.c_str());
+            return 1;
+        }
+    }
+
+    std::size_t rows = 0;
+    std::vector<std::string> failed;  // --check: rows above tolerance
+    const InputClass inputs[] = {InputClass::Random, InputClass::HugeTheta, InputClass::MinDlead,
+                                 InputClass::MaxDlead, InputClass::NearEpsilon, InputClass::TinyRadius,
+                                 InputClass::HugeCurvature};
+    for (InputClass input : inputs) {
+        const PoseSet set = makePoses(input, options.points, 4321 + static_cast<int>(input));
+        for (Family family : {Family::Arc, Family::Curvature}) {
+            for (std::size_t i = 0; i < set.x.size(); ++i) {
+                Point p = family == Family::Arc
+                    ? ruledPoint(set.x[i], set.y[i], set.theta[i], set.dlead[i], set.radius[i], libmSinCos)
+                    : ruledPointWithCurvature(set.x[i], set.y[i], set.theta[i], set.dlead[i], set.curvature[i],
+                                              libmSinCos);
+                refX[i] = p.x;
+                refY[i] = p.y;
+            }
+            const char *familyName = family == Family::Arc ? "arc" : "curvature";
+
+            for (std::size_t b = 0; b < backends.size(); ++b) {
+                const Backend &backend = backends[b];
+                std::string name = std::string(familyName) + "/" + backend.name + "/" + set.name;
+                if (backend.family != family ||
+                    (!options.filter.empty() && name.find(options.filter) == std::string::npos)) {
+                    continue;
+                }
+                double ns = timeBackend(options, backend, set, outX, outY);
+                ErrorStats err = compare(refX, refY, outX, outY);
+                if (dump) {
+                    std::fwrite(outX.data(), sizeof(double), set.x.size(), dump);
+                    std::fwrite(outY.data(), sizeof(double), set.x.size(), dump);
+                }
+                if (baseline) {
+                    comparison.add(name, outX.data(), baseline, set.x.size());
+                    comparison.add(name, outY.data(), baseline, set.x.size());
+                }
+                ++rows;
+                if (err.nonFinite != 0 || err.maxAbs > options.tolerance) {
+                    failed.push_back(name);
+                }
+                summaries[b].worstAbs = std::max(summaries[b].worstAbs, err.maxAbs);
+                summaries[b].nonFinite += err.nonFinite;
+                summaries[b].totalNs += ns;
+                ++summaries[b].classes;
+                if (options.csv) {
+                    std::printf("%s,%s,%s,%.6g,%.6g,%llu,%zu,%.4f\n", familyName, backend.name.c_str(),
+                                set.name.c_str(), err.maxAbs, err.meanAbs,
+                                static_cast<unsigned long long>(err.maxUlp), err.nonFinite, ns);
+                } else {
+                    std::printf("%-44s %11.3g %11.3g %12llu %9zu %10.3f\n", name.c_str(), err.maxAbs, err.meanAbs,
+                                static_cast<unsigned long long>(err.maxUlp), err.nonFinite, ns);
+                }
+            }
+        }
+    }
+
+    if (dump && std::fclose(dump) != 0) {
+        std::fprintf(stderr, "Cannot write %s\n", options.dumpPath.c_str());
+        return 1;
+    }
+    if (baseline) {
+        bool longFile = std::fgetc(baseline) != EOF;
+        std::fclose(baseline);
+        if (comparison.shortFile || longFile) {
+            std::fprintf(stderr, "%s was not written with the same options\n", options.comparePath.c_str());
+            return 1;
+        }
+        std::fprintf(stderr,
+                     "compare: %zu of %zu values differ, %zu in finiteness, max abs %.3g, max ulp %llu%s%s\n",
+                     comparison.differing, comparison.values, comparison.nonFinite, comparison.maxAbs,
+                     static_cast<unsigned long long>(comparison.maxUlp), comparison.worst.empty() ? "" : " at ",
+                     comparison.worst.c_str());
+    }
+
+    // Fastest backend (mean ns/point over the input classes) within tolerance everywhere
+    if (!options.csv) {
+        for (Family family : {Family::Arc, Family::Curvature}) {
+            const char *familyName = family == Family::Arc ? "arc" : "curvature";
+            int best = -1;
+            double bestNs = 0.0;
+            for (std::size_t b = 0; b < backends.size(); ++b) {
+                const Summary &s = summaries[b];
+                if (backends[b].family != family || s.classes == 0 || s.nonFinite != 0 ||
+                    s.worstAbs > options.tolerance) {
+                    continue;
+                }
+                double ns = s.totalNs / s.classes;
+                if (best < 0 || ns < bestNs) {
+                    best = static_cast<int>(b);
+                    bestNs = ns;
+                }
+            }
+            if (best < 0) {
+                std::printf("%s: no backend within %.3g\n", familyName, options.tolerance);
+            } else {
+                std::printf("%s: fastest within %.3g is %s (%.3f ns/point, worst error %.3g)\n", familyName,
+                            options.tolerance, backends[best].name.c_str(), bestNs, summaries[best].worstAbs);
+            }
+        }
+    }
+
+    if (options.check) {
+        for (const std::string &name : failed) {
+            std::fprintf(stderr, "check failed: %s exceeds %.3g or differs in finiteness\n", name.c_str(),
+                         options.tolerance);
+        }
+        if (rows == 0) {
+            std::fprintf(stderr, "check failed: filter '%s' selects no backend\n", options.filter.c_str());
+        }
+        return failed.empty() && rows > 0 ? 0 : 1;
+    }
+    return 0;
+}
@@ -0,0 +1,514 @@
+// ============================================
+// Geometry Kernel Microbenchmarks
+// ============================================
+// Times every curve kernel over several input distributions and reports
+// ns/point, Mpoints/s and cycles/point (TSC reference cycles on x86).
+//
+// Usage: geometry_bench [--filter TEXT] [--points N] [--min-time SECONDS] [--csv]
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include "../headerFiLES/angles.hpp"
+#include "../headerFiLES/cache.hpp"
+#include "../headerFiLES/clothoid.hpp"
+#include "../headerFiLES/controller.hpp"
+#include "../headerFiLES/follower.hpp"
+#include "../headerFiLES/inverse.hpp"
+#include "../headerFiLES/offload.hpp"
+#include "../headerFiLES/parallel.hpp"
+#include "../headerFiLES/path.hpp"
+#include "../headerFiLES/spatial.hpp"
+#include "../headerFiLES/sweep.hpp"
+#include "../headerFiLES/trajectory.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    static inline unsigned long long readCycles() { return __rdtsc(); }
+    static const bool HAVE_CYCLES = true;
+#else
+    static inline unsigned long long readCycles() { return 0; }
+    static const bool HAVE_CYCLES = false;
+#endif
+
+// ============================================
+// Input Distributions
+// ============================================
+struct PoseSet {
+    std::string name;
+    std::vector<double> x, y, theta, dlead, radius, curvature;
+};
+
+enum class Distribution {
+    SmallDlead,     // |dlead| just above MIN_DLEAD
+    ClampedDlead,   // |dlead| beyond MAX_DLEAD
+    NearZeroCurve,  // |curvature| around EPSILON (straight-line branch)
+    Mixed           // everything, including the edge cases
+};
+
+static PoseSet makePoses(Distribution dist, std::size_t count, std::uint64_t seed) {
+    static const char *names[] = {"small-dlead", "clamped-dlead", "near-zero-curvature", "mixed"};
+    PoseSet set;
+    set.name = names[static_cast<int>(dist)];
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> pos(-100.0, 100.0);
+    std::uniform_real_distribution<double> ang(-M_PI, M_PI);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    for (std::vector<double> *column : {&set.x, &set.y, &set.theta, &set.dlead, &set.radius, &set.curvature}) {
+        column->resize(count);
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        set.x[i] = pos(rng);
+        set.y[i] = pos(rng);
+        set.theta[i] = ang(rng);
+        double sign = unit(rng) < 0.5 ? -1.0 : 1.0;
+        double radius = 0.1 + 10.0 * unit(rng);
+        switch (dist) {
+            case Distribution::SmallDlead:
+                set.dlead[i] = sign * MIN_DLEAD * (1.0 + 9.0 * unit(rng));
+                break;
+            case Distribution::ClampedDlead:
+                set.dlead[i] = sign * MAX_DLEAD * (1.0 + 9.0 * unit(rng));
+                break;
+            case Distribution::NearZeroCurve:
+                set.dlead[i] = sign * 5.0 * unit(rng);
+                radius = 1.0 / (EPSILON * 2.0 * unit(rng) + 1e-300);
+                break;
+            case Distribution::Mixed: {
+                double pick = unit(rng);
+                set.dlead[i] = pick < 0.1 ? sign * MIN_DLEAD * 0.5
+                             : pick < 0.2 ? sign * MAX_DLEAD * 2.0
+                             : sign * 5.0 * unit(rng);
+                radius = pick > 0.9 ? 0.0 : radius;
+                break;
+            }
+        }
+        set.radius[i] = radius;
+        double curvature = radius != 0.0 ? 1.0 / radius : 0.0;
+        set.curvature[i] = unit(rng) < 0.5 ? -curvature : curvature;
+    }
+    return set;
+}
+
+// ============================================
+// Harness
+// ============================================
+struct Options {
+    std::string filter;
+    std::size_t points = 1 << 16;
+    double minTime = 0.2;
+    bool csv = false;
+};
+
+static volatile double sink;
+
+/**
+ * @brief Runs body() until minTime has elapsed and reports the best pass
+ */
+static void runBenchmark(const Options &options, const std::string &kernel, const PoseSet &set,
+                         const std::function<void()> &body) {
+    std::string name = kernel + "/" + set.name;
+    if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+        return;
+    }
+
+    body();  // Warm-up
+
+    double bestSeconds = 1e30;
+    unsigned long long bestCycles = 0;
+    double total = 0.0;
+    int passes = 0;
+    while (total < options.minTime || passes < 5) {
+        unsigned long long c0 = readCycles();
+        auto t0 = std::chrono::steady_clock::now();
+        body();
+        auto t1 = std::chrono::steady_clock::now();
+        unsigned long long c1 = readCycles();
+        double seconds = std::chrono::duration<double>(t1 - t0).count();
+        if (seconds < bestSeconds) {
+            bestSeconds = seconds;
+            bestCycles = c1 - c0;
+        }
+        total += seconds;
+        ++passes;
+    }
+
+    double n = static_cast<double>(set.x.size());
+    double nsPerPoint = bestSeconds * 1e9 / n;
+    double mpps = n / bestSeconds / 1e6;
+    double cyclesPerPoint = HAVE_CYCLES ? static_cast<double>(bestCycles) / n : 0.0;
+    if (options.csv) {
+        std::printf("%s,%s,%.4f,%.3f,%.3f\n", kernel.c_str(), set.name.c_str(), nsPerPoint, mpps, cyclesPerPoint);
+    } else {
+        std::printf("%-64s %10.3f %12.2f %12.2f\n", name.c_str(), nsPerPoint, mpps, cyclesPerPoint);
+    }
+}
+
+static bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--csv") {
+            options.csv = true;
+        } else if (arg == "--filter" && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if (arg == "--points" && i + 1 < argc) {
+            options.points = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--min-time" && i + 1 < argc) {
+            options.minTime = std::strtod(argv[++i], nullptr);
+        } else {
+            std::fprintf(stderr, "Usage: %s [--filter TEXT] [--points N] [--min-time SECONDS] [--csv]\n", argv[0]);
+            return false;
+        }
+    }
+    return options.points > 0;
+}
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+
+    if (options.csv) {
+        std::printf("kernel,distribution,ns_per_point,mpoints_per_s,cycles_per_point\n");
+    } else {
+        std::printf("points=%zu simd=%s trig=%s (max error %.2g) cycles=%s\n", options.points,
+                    simdLevelName(activeSimdLevel()), trigBackendInfo().name, trigBackendInfo().maxError,
+                    HAVE_CYCLES ? "tsc" : "n/a");
+        std::printf("%-64s %10s %12s %12s\n", "kernel/distribution", "ns/point", "Mpoints/s", "cycles/point");
+    }
+
+    std::vector<double> outX(options.points), outY(options.points);
+    std::vector<Point> outPoints(options.points);
+    std::vector<unsigned char> arenaBuffer(options.points * sizeof(Point) + alignof(Point));
+    PathArena arena(arenaBuffer.data(), arenaBuffer.size());
+    WorkStealingPool pool;
+    BatchOffloader offloader(pool);
+
+    // 512-segment route of lines, arcs and clothoids for the route/ kernels
+    SegmentPath route;
+    {
+        std::mt19937 rng(77);
+        std::uniform_real_distribution<double> length(0.5, 20.0);
+        std::uniform_real_distribution<double> curvature(-0.2, 0.2);
+        double k = 0.0;
+        for (int i = 0; i < 512; ++i) {
+            double next = curvature(rng);
+            switch (i % 3) {
+                case 0: route.appendLine(length(rng)); k = 0.0; break;
+                case 1: route.appendClothoid(k, next, length(rng)); k = next; break;
+                default: route.appendArc(k, length(rng)); break;
+            }
+        }
+    }
+
+    const Distribution distributions[] = {Distribution::SmallDlead, Distribution::ClampedDlead,
+                                          Distribution::NearZeroCurve, Distribution::Mixed};
+    for (Distribution dist : distributions) {
+        const PoseSet set = makePoses(dist, options.points, 1234 + static_cast<int>(dist));
+        const std::size_t n = set.x.size();
+
+        runBenchmark(options, "scalar/calculateColinearPoint", set, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                Point p = calculateColinearPoint(set.x[i], set.y[i], set.theta[i], set.dlead[i], set.radius[i]);
+                outX[i] = p.x;
+                outY[i] = p.y;
+            }
+        });
+        runBenchmark(options, "scalar/calculateColinearPointWithCurvature", set, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                Point p = calculateColinearPointWithCurvature(set.x[i], set.y[i], set.theta[i], set.dlead[i],
+                                                              set.curvature[i]);
+                outX[i] = p.x;
+                outY[i] = p.y;
+            }
+        });
+        // Straight-line branch, the same formula collinearCalc() uses
+        runBenchmark(options, "scalar/straightLine", set, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                Point p = calculateColinearPointWithCurvature(set.x[i], set.y[i], set.theta[i], set.dlead[i], 0.0);
+                outX[i] = p.x;
+                outY[i] = p.y;
+            }
+        });
+        runBenchmark(options, "scalar/float", set, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                BasicPoint<float> p = basicColinearPoint(
+                    makeBasicPoseContext<float>(static_cast<float>(set.x[i]), static_cast<float>(set.y[i]),
+                                                static_cast<float>(set.theta[i])),
+                    static_cast<float>(set.dlead[i]), static_cast<float>(set.radius[i]));
+                outX[i] = p.x;
+                outY[i] = p.y;
+            }
+        });
+        // Trig backends on the arc angle alone
+        runBenchmark(options, "trig/sinCos", set, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                sinCos(set.dlead[i] / set.radius[i], outX[i], outY[i]);
+            }
+        });
+        runBenchmark(options, "trig/lutSinCos<256,linear>", set, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                lutSinCos<double, 256, 1>(set.dlead[i] / set.radius[i], outX[i], outY[i]);
+            }
+        });
+        runBenchmark(options, "trig/lutSinCos<256,quadratic>", set, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                lutSinCos<double, 256, 2>(set.dlead[i] / set.radius[i], outX[i], outY[i]);
+            }
+        });
+        // Odometry-style headings of a few thousand degrees
+        {
+            std::vector<double> headingDegrees(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                headingDegrees[i] = set.theta[i] * 1000.0;
+            }
+            runBenchmark(options, "angle/remainder", set, [&] {
+                for (std::size_t i = 0; i < n; ++i) {
+                    outX[i] = std::remainder(headingDegrees[i], 360.0);
+                }
+            });
+            runBenchmark(options, "angle/wrapDegreesBatch", set, [&] {
+                wrapDegreesBatch(headingDegrees.data(), n, outX.data());
+            });
+            runBenchmark(options, "angle/wrapAngleBatch", set, [&] {
+                wrapAngleBatch(headingDegrees.data(), n, outX.data());
+            });
+            runBenchmark(options, "angle/calculateColinearPoint(degreesToRadians)", set, [&] {
+                for (std::size_t i = 0; i < n; ++i) {
+                    Point p = calculateColinearPoint(set.x[i], set.y[i], degreesToRadians(headingDegrees[i]),
+                                                     set.dlead[i], set.radius[i]);
+                    outX[i] = p.x;
+                    outY[i] = p.y;
+                }
+            });
+            runBenchmark(options, "angle/calculateColinearPointDegrees", set, [&] {
+                for (std::size_t i = 0; i < n; ++i) {
+                    Point p = calculateColinearPointDegrees(set.x[i], set.y[i], headingDegrees[i], set.dlead[i],
+                                                            set.radius[i]);
+                    outX[i] = p.x;
+                    outY[i] = p.y;
+                }
+            });
+        }
+        runBenchmark(options, "batch/calculateColinearPointBatch", set, [&] {
+            calculateColinearPointBatch(set.x.data(), set.y.data(), set.theta.data(), set.dlead.data(),
+                                        set.radius.data(), n, outX.data(), outY.data());
+        });
+        runBenchmark(options, "batch/calculateColinearPointWithCurvatureBatch", set, [&] {
+            calculateColinearPointWithCurvatureBatch(set.x.data(), set.y.data(), set.theta.data(), set.dlead.data(),
+                                                     set.curvature.data(), n, outX.data(), outY.data());
+        });
+        for (SimdLevel level : {SimdLevel::Avx2, SimdLevel::Avx512}) {
+            if (static_cast<int>(level) > static_cast<int>(activeSimdLevel())) {
+                continue;
+            }
+            std::string suffix = simdLevelName(level);
+            runBenchmark(options, "simd-" + suffix + "/calculateColinearPointBatchSimd", set, [&] {
+                calculateColinearPointBatchSimd(set.x.data(), set.y.data(), set.theta.data(), set.dlead.data(),
+                                                set.radius.data(), n, outX.data(), outY.data(), level);
+            });
+            runBenchmark(options, "simd-" + suffix + "/calculateColinearPointWithCurvatureBatchSimd", set, [&] {
+                calculateColinearPointWithCurvatureBatchSimd(set.x.data(), set.y.data(), set.theta.data(),
+                                                             set.dlead.data(), set.curvature.data(), n,
+                                                             outX.data(), outY.data(), level);
+            });
+        }
+        // Clothoids whose curvature ramps back to zero over each lookahead,
+        // against the usual workaround of chaining short constant arcs
+        {
+            std::vector<double> rate(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                double length = std::abs(set.dlead[i]) < MIN_DLEAD ? 1.0 : set.dlead[i];
+                rate[i] = -set.curvature[i] / length;
+            }
+            runBenchmark(options, "clothoid/calculateClothoidPointBatch", set, [&] {
+                calculateClothoidPointBatch(set.x.data(), set.y.data(), set.theta.data(), set.dlead.data(),
+                                            set.curvature.data(), rate.data(), n, outX.data(), outY.data());
+            });
+            runBenchmark(options, "clothoid/arc-chain-32", set, [&] {
+                const int pieces = 32;
+                for (std::size_t i = 0; i < n; ++i) {
+                    double step = set.dlead[i] / pieces;
+                    double px = set.x[i];
+                    double py = set.y[i];
+                    double heading = set.theta[i];
+                    for (int k = 0; k < pieces; ++k) {
+                        double curvature = set.curvature[i] + rate[i] * step * (k + 0.5);
+                        Point p = calculateColinearPointWithCurvature(px, py, heading, step, curvature);
+                        px = p.x;
+                        py = p.y;
+                        heading += curvature * step;
+                    }
+                    outX[i] = px;
+                    outY[i] = py;
+                }
+            });
+        }
+        runBenchmark(options, "sample/sampleColinearPointsUniform", set, [&] {
+            PoseContext pose = makePoseContext(set.x[0], set.y[0], set.theta[0]);
+            sampleColinearPointsUniform(pose, set.dlead[0], 1e-3, n, set.radius[0], outPoints.data());
+        });
+        // Replanning: a fresh vector per path vs. a recycled arena
+        runBenchmark(options, "path/vector-push_back", set, [&] {
+            PoseContext pose = makePoseContext(set.x[0], set.y[0], set.theta[0]);
+            std::vector<Point> path;
+            for (std::size_t i = 0; i < n; ++i) {
+                path.push_back(calculateColinearPoint(pose, set.dlead[0] + 1e-3 * static_cast<double>(i),
+                                                      set.radius[0]));
+            }
+            outPoints[0] = path.back();
+        });
+        runBenchmark(options, "path/generatePath(arena)", set, [&] {
+            PoseContext pose = makePoseContext(set.x[0], set.y[0], set.theta[0]);
+            arena.reset();
+            PathView path = generatePath(arena, pose, set.dlead[0], 1e-3, n, set.radius[0]);
+            outPoints[0] = path[n - 1];
+        });
+        // Global lookahead on the route: scanning the segments from the start
+        // vs. the prefix-sum search vs. a sorted batch walking forward
+        {
+            std::vector<double> distance(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                distance[i] = std::fmod(std::abs(set.dlead[i]) * 101.0, route.length());
+            }
+            std::vector<double> sorted(distance);
+            std::sort(sorted.begin(), sorted.end());
+            runBenchmark(options, "route/linear-scan", set, [&] {
+                for (std::size_t i = 0; i < n; ++i) {
+                    std::size_t j = 0;
+                    while (j + 1 < route.segmentCount() && distance[i] >= route.segmentStart(j + 1)) {
+                        ++j;
+                    }
+                    outPoints[i] = route.pointOnSegment(j, distance[i]);
+                }
+            });
+            runBenchmark(options, "route/SegmentPath::pointAt", set, [&] {
+                for (std::size_t i = 0; i < n; ++i) {
+                    outPoints[i] = route.pointAt(distance[i]);
+                }
+            });
+            runBenchmark(options, "route/pointsAtBatch(sorted)", set, [&] {
+                route.pointsAtBatch(sorted.data(), n, outPoints.data());
+            });
+        }
+        // Encoder-quantized copy of the set (5 degree heading, 0.5 dlead and
+        // 1.0 radius steps): direct evaluation vs. the memoization cache
+        {
+            std::vector<double> theta(n), dlead(n), radius(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                theta[i] = std::round(set.theta[i] / degreesToRadians(5.0)) * degreesToRadians(5.0);
+                dlead[i] = std::round(std::max(std::min(set.dlead[i], 10.0), -10.0) * 2.0) * 0.5;
+                radius[i] = std::round(set.radius[i] > 10.0 ? 10.0 : set.radius[i]);
+            }
+            CacheQuantization steps;
+            steps.angle = degreesToRadians(5.0);
+            steps.length = 0.5;
+            ColinearPointCache cache(COLINEAR_CACHE_DEFAULT_CAPACITY, steps);
+            runBenchmark(options, "cache/quantized-direct", set, [&] {
+                for (std::size_t i = 0; i < n; ++i) {
+                    Point p = calculateColinearPoint(set.x[i], set.y[i], theta[i], dlead[i], radius[i]);
+                    outX[i] = p.x;
+                    outY[i] = p.y;
+                }
+            });
+            runBenchmark(options, "cache/ColinearPointCache::lookup", set, [&] {
+                cachedColinearPointBatch(cache, set.x.data(), set.y.data(), theta.data(), dlead.data(),
+                                         radius.data(), n, outX.data(), outY.data());
+            });
+        }
+        // One controller tick per point: same pose, dlead growing each tick
+        runBenchmark(options, "follower/ArcFollower::update", set, [&] {
+            PoseContext pose = makePoseContext(set.x[0], set.y[0], set.theta[0]);
+            ArcFollower follower;
+            double dlead = set.dlead[0];
+            for (std::size_t i = 0; i < n; ++i) {
+                dlead += 1e-3;
+                outPoints[i] = follower.update(pose, dlead, set.radius[0]);
+            }
+        });
+        // Closest path point for robots near a 10k-sample path (within 1 unit)
+        {
+            PoseContext pose = makePoseContext(set.x[0], set.y[0], set.theta[0]);
+            std::vector<Point> path(10000);
+            sampleColinearPointsUniform(pose, 0.0, 1e-3, path.size(), 10.0, path.data());
+            PathIndex index(path.data(), path.size());
+            auto nearPath = [&](std::size_t i) {
+                const Point &p = path[i % path.size()];
+                return Point{p.x + set.x[i] * 0.01, p.y + set.y[i] * 0.01};
+            };
+            runBenchmark(options, "nearest/PathIndex::nearest", set, [&] {
+                for (std::size_t i = 0; i < n; ++i) {
+                    outX[i] = static_cast<double>(index.nearest(nearPath(i)));
+                }
+            });
+            runBenchmark(options, "nearest/projectOntoArc", set, [&] {
+                for (std::size_t i = 0; i < n; ++i) {
+                    outX[i] = projectOntoArc(pose, 10.0, nearPath(i), 0.0, 10.0);
+                }
+            });
+        }
+        // Inverse solves from each pose to a fixed offset target
+        runBenchmark(options, "inverse/solveArcThroughPoint", set, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                PoseContext pose = makePoseContext(set.x[i], set.y[i], set.theta[i]);
+                double curvature;
+                solveArcThroughPoint(pose, Point{set.x[i] + 3.0, set.y[i] + 2.0}, outX[i], curvature);
+            }
+        });
+        runBenchmark(options, "inverse/solveDleadForPoint", set, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                PoseContext pose = makePoseContext(set.x[i], set.y[i], set.theta[i]);
+                outX[i] = solveDleadForPoint(pose, 2.0, Point{set.x[i] + 3.0, set.y[i] + 2.0});
+            }
+        });
+        // Controller stage: carrot batch then a second pass for bearing and
+        // chord length, vs. the fused single pass
+        {
+            std::vector<double> chordBearing(n), chordLength(n);
+            runBenchmark(options, "controller/batch+second-pass", set, [&] {
+                calculateColinearPointBatch(set.x.data(), set.y.data(), set.theta.data(), set.dlead.data(),
+                                            set.radius.data(), n, outX.data(), outY.data());
+                for (std::size_t i = 0; i < n; ++i) {
+                    double dx = outX[i] - set.x[i];
+                    double dy = outY[i] - set.y[i];
+                    double bearing = std::atan2(dy, dx) - set.theta[i];
+                    chordBearing[i] = std::remainder(bearing, 2.0 * M_PI);
+                    chordLength[i] = std::sqrt(dx * dx + dy * dy);
+                }
+            });
+            runBenchmark(options, "controller/boomerangCarrotBatch", set, [&] {
+                boomerangCarrotBatch(set.x.data(), set.y.data(), set.theta.data(), set.dlead.data(),
+                                     set.radius.data(), n, outX.data(), outY.data(), chordBearing.data(),
+                                     chordLength.data());
+            });
+        }
+        runBenchmark(options, "parallel/parallelColinearPointBatch", set, [&] {
+            parallelColinearPointBatch(pool, set.x.data(), set.y.data(), set.theta.data(), set.dlead.data(),
+                                       set.radius.data(), n, outX.data(), outY.data());
+        });
+        // Generated grid of n points (64 thetas x 16 radii x n / 1024 dleads)
+        if (n >= 1024) {
+            SweepSpec spec;
+            spec.theta = SweepAxis{-M_PI, M_PI / 32.0, 64};
+            spec.radius = SweepAxis{0.5, 0.5, 16};
+            spec.dlead = SweepAxis{0.0, 0.01, n / 1024};
+            runBenchmark(options, "sweep/evaluateSweep", set, [&] {
+                evaluateSweep(static_cast<WorkStealingPool *>(nullptr), spec, outX.data(), outY.data());
+            });
+        }
+        runBenchmark(options, std::string("offload/BatchOffloader(") + offloader.backendName() + ")", set, [&] {
+            offloader.colinearPointBatch(set.x.data(), set.y.data(), set.theta.data(), set.dlead.data(),
+                                         set.radius.data(), n, outX.data(), outY.data());
+        });
+    }
+
+    sink = outX[0] + outY[0] + outPoints[0].x;
+    return 0;
+}
@@ -0,0 +1,78 @@
+// ============================================
+// Parallel Batch Scaling Benchmark
+// ============================================
+// Measures parallelColinearPointBatch() throughput for 1, 2, 4, ... up to
+// the hardware thread count and checks every run against the serial
+// output bit for bit; the exit status is 1 if any run differs.
+//
+// Usage: parallel_scaling [poses] [maxThreads]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+#include "../headerFiLES/parallel.hpp"
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 8000000;
+    unsigned maxThreads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10))
+                                   : std::thread::hardware_concurrency();
+    if (maxThreads == 0) {
+        maxThreads = 1;
+    }
+
+    std::vector<double> x(count), y(count), theta(count), dlead(count), radius(count);
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> pos(-100.0, 100.0);
+    std::uniform_real_distribution<double> ang(-M_PI, M_PI);
+    std::uniform_real_distribution<double> lead(-5.0, 5.0);
+    std::uniform_real_distribution<double> rad(0.1, 10.0);
+    for (std::size_t i = 0; i < count; ++i) {
+        x[i] = pos(rng);
+        y[i] = pos(rng);
+        theta[i] = ang(rng);
+        dlead[i] = lead(rng);
+        radius[i] = rad(rng);
+    }
+
+    std::vector<double> refX(count), refY(count), outX(count), outY(count);
+    calculateColinearPointBatchSimd(x.data(), y.data(), theta.data(), dlead.data(),
+                                    radius.data(), count, refX.data(), refY.data());
+
+    std::printf("poses=%zu simd=%s\n", count, simdLevelName(activeSimdLevel()));
+    std::printf("%8s %14s %14s %10s %8s\n", "threads", "Mpoints/s", "Mpoints/s/core", "speedup", "match");
+
+    double baseline = 0.0;
+    bool allMatch = true;
+    for (unsigned threads = 1;; threads = threads * 2 < maxThreads ? threads * 2 : maxThreads) {
+        WorkStealingPool pool(threads);
+
+        // One warm-up pass, then keep the best of three
+        parallelColinearPointBatch(pool, x.data(), y.data(), theta.data(), dlead.data(),
+                                   radius.data(), count, outX.data(), outY.data());
+        double best = 1e30;
+        for (int rep = 0; rep < 3; ++rep) {
+            auto start = std::chrono::steady_clock::now();
+            parallelColinearPointBatch(pool, x.data(), y.data(), theta.data(), dlead.data(),
+                                       radius.data(), count, outX.data(), outY.data());
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            best = elapsed.count() < best ? elapsed.count() : best;
+        }
+
+        bool match = std::memcmp(outX.data(), refX.data(), count * sizeof(double)) == 0
+                  && std::memcmp(outY.data(), refY.data(), count * sizeof(double)) == 0;
+        allMatch = allMatch && match;
+        double mps = static_cast<double>(count) / best / 1e6;
+        if (threads == 1) {
+            baseline = mps;
+        }
+        std::printf("%8u %14.2f %14.2f %9.2fx %8s\n", threads, mps, mps / threads,
+                    baseline > 0.0 ? mps / baseline : 0.0, match ? "yes" : "NO");
+        if (threads == maxThreads) {
+            break;
+        }
+    }
+    return allMatch ? 0 : 1;
+}
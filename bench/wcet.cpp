@@ -0,0 +1,327 @@
+// ============================================
+// Worst-Case Execution Time Harness
+// ============================================
+// Times single calls of the real-time entry points (realtime.hpp) and, for
+// comparison, of the libm-based reference, over input classes chosen to
+// hit every edge case. For each function and class it reports the
+// minimum, median, p99, p99.99 and maximum ticks per call, with the
+// timer overhead subtracted, then the worst case over all classes.
+//
+// Timers:
+// - x86:     TSC between lfence barriers (reference cycles, like
+//            geometry_bench)
+// - AArch64: the generic timer cntvct_el0 (reports its frequency); build
+//            with -DCOLINEAR_WCET_PMCCNTR for core cycles from
+//            pmccntr_el0, which needs user access enabled by the kernel
+// - other:   steady_clock nanoseconds
+//
+// The max column includes interrupts and preemption; for a meaningful
+// bound run on an isolated core (--cpu) under a real-time scheduler.
+// Subnormal operands take microcode assists on x86; --ftz sets FTZ/DAZ
+// in MXCSR, as real-time threads usually do, to show the cost without.
+//
+// Usage: wcet_harness [--samples N] [--cpu N] [--ftz] [--csv]
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "../headerFiLES/realtime.hpp"
+#if defined(__linux__)
+    #include <sched.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    static inline std::uint64_t timerStart() {
+        _mm_lfence();
+        std::uint64_t t = __rdtsc();
+        _mm_lfence();
+        return t;
+    }
+    static inline std::uint64_t timerStop() {
+        unsigned aux;
+        std::uint64_t t = __rdtscp(&aux);
+        _mm_lfence();
+        return t;
+    }
+    static const char *TIMER_NAME = "tsc";
+    static double timerFrequency() { return 0.0; }
+#elif defined(__aarch64__)
+    static inline std::uint64_t readTimer() {
+        std::uint64_t t;
+        #if defined(COLINEAR_WCET_PMCCNTR)
+            asm volatile("isb\n\tmrs %0, pmccntr_el0" : "=r"(t) : : "memory");
+        #else
+            asm volatile("isb\n\tmrs %0, cntvct_el0" : "=r"(t) : : "memory");
+        #endif
+        return t;
+    }
+    static inline std::uint64_t timerStart() { return readTimer(); }
+    static inline std::uint64_t timerStop() { return readTimer(); }
+    #if defined(COLINEAR_WCET_PMCCNTR)
+        static const char *TIMER_NAME = "pmccntr";
+        static double timerFrequency() { return 0.0; }
+    #else
+        static const char *TIMER_NAME = "cntvct";
+        static double timerFrequency() {
+            std::uint64_t f;
+            asm volatile("mrs %0, cntfrq_el0" : "=r"(f));
+            return static_cast<double>(f);
+        }
+    #endif
+#else
+    static inline std::uint64_t readTimer() {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+    static inline std::uint64_t timerStart() { return readTimer(); }
+    static inline std::uint64_t timerStop() { return readTimer(); }
+    static const char *TIMER_NAME = "steady_clock-ns";
+    static double timerFrequency() { return 1e9; }
+#endif
+
+// ============================================
+// Input Classes
+// ============================================
+struct WcetInput {
+    double x, y, theta, dlead, shape;  // shape is radius or curvature
+};
+
+enum class InputClass {
+    Nominal,        // Ordinary poses
+    MinDlead,       // |dlead| < MIN_DLEAD (early return in the reference)
+    ClampedDlead,   // |dlead| > MAX_DLEAD
+    ZeroRadius,     // |shape| < EPSILON (default radius / straight line)
+    LargeArc,       // radius just above EPSILON with long dlead (phi up to 1e15)
+    LargeTheta,     // Unwrapped headings around 1e5 rad
+    Subnormal,      // Subnormal positions and lookahead
+    NotFinite,      // NaN and infinite inputs
+    Count
+};
+
+static const char *inputClassName(InputClass cls) {
+    static const char *names[] = {"nominal", "min-dlead", "clamped-dlead", "zero-radius", "large-arc",
+                                  "large-theta", "subnormal", "not-finite"};
+    return names[static_cast<int>(cls)];
+}
+
+static std::vector<WcetInput> makeInputs(InputClass cls, std::size_t count, std::uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> pos(-100.0, 100.0);
+    std::uniform_real_distribution<double> ang(-M_PI, M_PI);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::vector<WcetInput> inputs(count);
+    for (WcetInput &in : inputs) {
+        double sign = unit(rng) < 0.5 ? -1.0 : 1.0;
+        in = WcetInput{pos(rng), pos(rng), ang(rng), sign * 5.0 * unit(rng), 0.1 + 10.0 * unit(rng)};
+        switch (cls) {
+            case InputClass::Nominal:
+                break;
+            case InputClass::MinDlead:
+                in.dlead = sign * MIN_DLEAD * unit(rng);
+                break;
+            case InputClass::ClampedDlead:
+                in.dlead = sign * MAX_DLEAD * (1.0 + 9.0 * unit(rng));
+                break;
+            case InputClass::ZeroRadius:
+                in.shape = EPSILON * unit(rng);
+                break;
+            case InputClass::LargeArc:
+                in.dlead = sign * MAX_DLEAD * unit(rng);
+                in.shape = EPSILON * (1.0 + unit(rng));
+                break;
+            case InputClass::LargeTheta:
+                in.theta = sign * 1e5 * (1.0 + unit(rng));
+                break;
+            case InputClass::Subnormal:
+                in.x = std::numeric_limits<double>::denorm_min() * (1.0 + 1e6 * unit(rng));
+                in.y = -in.x;
+                in.dlead = sign * std::numeric_limits<double>::min() * unit(rng);
+                break;
+            case InputClass::NotFinite: {
+                double special = unit(rng) < 0.5 ? std::numeric_limits<double>::quiet_NaN()
+                                                 : sign * std::numeric_limits<double>::infinity();
+                double pick = unit(rng);
+                (pick < 0.25 ? in.x : pick < 0.5 ? in.theta : pick < 0.75 ? in.dlead : in.shape) = special;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    return inputs;
+}
+
+// ============================================
+// Harness
+// ============================================
+struct Options {
+    std::size_t samples = 100000;
+    int cpu = -1;
+    bool ftz = false;
+    bool csv = false;
+};
+
+struct Summary {
+    std::uint64_t min, median, p99, p9999, max;
+};
+
+static volatile double sink;
+
+static std::uint64_t percentile(const std::vector<std::uint64_t> &sorted, double p) {
+    std::size_t i = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1));
+    return sorted[i];
+}
+
+/**
+ * @brief Times fn once per input and summarizes the overhead-corrected ticks
+ */
+template <typename Fn>
+static Summary measure(const std::vector<WcetInput> &inputs, std::uint64_t overhead, std::vector<std::uint64_t> &ticks,
+                       Fn fn) {
+    for (const WcetInput &in : inputs) {  // Warm-up: code, tables and branch predictors
+        Point p = fn(in);
+        sink = p.x + p.y;
+    }
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        const WcetInput in = inputs[i];
+        std::uint64_t t0 = timerStart();
+        Point p = fn(in);
+        sink = p.x;
+        sink = p.y;
+        std::uint64_t t1 = timerStop();
+        std::uint64_t t = t1 - t0;
+        ticks[i] = t > overhead ? t - overhead : 0;
+    }
+    std::sort(ticks.begin(), ticks.end());
+    return Summary{ticks.front(), percentile(ticks, 0.5), percentile(ticks, 0.99), percentile(ticks, 0.9999),
+                   ticks.back()};
+}
+
+/**
+ * @brief Median cost of an empty timed region
+ */
+static std::uint64_t timerOverhead(std::vector<std::uint64_t> &ticks) {
+    for (std::uint64_t &t : ticks) {
+        std::uint64_t t0 = timerStart();
+        std::uint64_t t1 = timerStop();
+        t = t1 - t0;
+    }
+    std::sort(ticks.begin(), ticks.end());
+    return percentile(ticks, 0.5);
+}
+
+static void printSummary(const Options &options, const std::string &kernel, const char *cls, const Summary &s) {
+    if (options.csv) {
+        std::printf("%s,%s,%llu,%llu,%llu,%llu,%llu\n", kernel.c_str(), cls, static_cast<unsigned long long>(s.min),
+                    static_cast<unsigned long long>(s.median), static_cast<unsigned long long>(s.p99),
+                    static_cast<unsigned long long>(s.p9999), static_cast<unsigned long long>(s.max));
+    } else {
+        std::string name = kernel + "/" + cls;
+        std::printf("%-60s %8llu %8llu %8llu %8llu %8llu\n", name.c_str(), static_cast<unsigned long long>(s.min),
+                    static_cast<unsigned long long>(s.median), static_cast<unsigned long long>(s.p99),
+                    static_cast<unsigned long long>(s.p9999), static_cast<unsigned long long>(s.max));
+    }
+}
+
+static bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--csv") {
+            options.csv = true;
+        } else if (arg == "--samples" && i + 1 < argc) {
+            options.samples = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--ftz") {
+            options.ftz = true;
+        } else if (arg == "--cpu" && i + 1 < argc) {
+            options.cpu = std::atoi(argv[++i]);
+        } else {
+            std::fprintf(stderr, "Usage: %s [--samples N] [--cpu N] [--ftz] [--csv]\n", argv[0]);
+            return false;
+        }
+    }
+    return options.samples > 0;
+}
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+    if (options.cpu >= 0) {
+        #if defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(options.cpu, &set);
+            if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+                std::fprintf(stderr, "warning: could not pin to cpu %d\n", options.cpu);
+            }
+        #else
+            std::fprintf(stderr, "warning: --cpu is only supported on Linux\n");
+        #endif
+    }
+
+    if (options.ftz) {
+        #if defined(__x86_64__) || defined(__i386__)
+            _mm_setcsr(_mm_getcsr() | 0x8040);  // FTZ | DAZ
+        #else
+            std::fprintf(stderr, "warning: --ftz is only supported on x86\n");
+        #endif
+    }
+
+    std::vector<std::uint64_t> ticks(options.samples);
+    std::uint64_t overhead = timerOverhead(ticks);
+    if (options.csv) {
+        std::printf("kernel,inputs,min,median,p99,p99.99,max\n");
+    } else {
+        double frequency = timerFrequency();
+        std::printf("samples=%zu timer=%s ftz=%s overhead=%llu", options.samples, TIMER_NAME, options.ftz ? "on" : "off",
+                    static_cast<unsigned long long>(overhead));
+        if (frequency > 0.0) {
+            std::printf(" (%.0f ticks/s)", frequency);
+        }
+        std::printf("\n%-60s %8s %8s %8s %8s %8s\n", "kernel/inputs", "min", "median", "p99", "p99.99", "max");
+    }
+
+    struct Kernel {
+        const char *name;
+        Point (*fn)(const WcetInput &);
+    };
+    const Kernel kernels[] = {
+        {"rtColinearPoint", [](const WcetInput &in) {
+             return rtColinearPoint(in.x, in.y, in.theta, in.dlead, in.shape);
+         }},
+        {"rtColinearPointWithCurvature", [](const WcetInput &in) {
+             return rtColinearPointWithCurvature(in.x, in.y, in.theta, in.dlead, in.shape);
+         }},
+        {"reference/calculateColinearPoint", [](const WcetInput &in) {
+             return calculateColinearPoint(in.x, in.y, in.theta, in.dlead, in.shape);
+         }},
+        {"reference/calculateColinearPointWithCurvature", [](const WcetInput &in) {
+             return calculateColinearPointWithCurvature(in.x, in.y, in.theta, in.dlead, in.shape);
+         }},
+    };
+
+    std::vector<std::vector<WcetInput>> inputs;
+    for (int c = 0; c < static_cast<int>(InputClass::Count); ++c) {
+        inputs.push_back(makeInputs(static_cast<InputClass>(c), options.samples, 4321 + c));
+    }
+    for (const Kernel &kernel : kernels) {
+        Summary worst{0, 0, 0, 0, 0};
+        for (int c = 0; c < static_cast<int>(InputClass::Count); ++c) {
+            Summary s = measure(inputs[c], overhead, ticks, kernel.fn);
+            printSummary(options, kernel.name, inputClassName(static_cast<InputClass>(c)), s);
+            worst = Summary{std::max(worst.min, s.min), std::max(worst.median, s.median), std::max(worst.p99, s.p99),
+                            std::max(worst.p9999, s.p9999), std::max(worst.max, s.max)};
+        }
+        printSummary(options, kernel.name, "worst", worst);
+    }
+    return 0;
+}
@@ -0,0 +1,301 @@
+# ============================================
+# Build-profile performance report (cmake -P, driven by the perf-report target)
+# ============================================
+# For every profile in PROFILES: configure and build geometry_bench and
+# accuracy_harness in WORK_DIR/<profile> with the same compiler, run
+# geometry_bench --csv BENCH_ARGS, and dump the accuracy_harness outputs.
+# Writes REPORT_PREFIX.csv (every timing) and REPORT_PREFIX.md (ns/point
+# per kernel with the speedup over the first profile, the mean speedup,
+# whether the double-precision results are bit-identical to the first
+# profile's and, if not, how many differ and by how much).
+#
+# Profiles:
+#   release     -O3 (CMake Release), generic target, no FMA contraction
+#   native      + -march=native
+#   lto         + link-time optimization
+#   native-lto  native + lto
+#   pgo         native + lto, trained on one short geometry_bench pass
+#   contract    native + lto + COLINEAR_FP_MODEL=contract
+#
+# There is no -ffast-math profile: it reassociates the Cody-Waite angle
+# reductions and drops the NaN / infinity handling the curve rules rely on.
+# Inputs (-D): SOURCE_DIR WORK_DIR REPORT_PREFIX GENERATOR CXX_COMPILER
+# TRIG_LUT PROFILES BENCH_ARGS (lists comma-separated)
+cmake_minimum_required(VERSION 3.14)
+
+string(REPLACE "," ";" PROFILES "${PROFILES}")
+string(REPLACE "," ";" BENCH_ARGS "${BENCH_ARGS}")
+if(NOT PROFILES)
+    message(FATAL_ERROR "PerfReport: no profiles given")
+endif()
+if(NOT TRIG_LUT)
+    set(TRIG_LUT OFF)
+endif()
+
+function(profile_settings profile out)
+    set(native -DCOLINEAR_NATIVE=ON)
+    set(lto -DCOLINEAR_LTO=ON)
+    if(profile STREQUAL "release")
+        set(settings)
+    elseif(profile STREQUAL "native")
+        set(settings ${native})
+    elseif(profile STREQUAL "lto")
+        set(settings ${lto})
+    elseif(profile STREQUAL "native-lto" OR profile STREQUAL "pgo")
+        set(settings ${native} ${lto})
+    elseif(profile STREQUAL "contract")
+        set(settings ${native} ${lto} -DCOLINEAR_FP_MODEL=contract)
+    else()
+        message(FATAL_ERROR "PerfReport: unknown profile '${profile}'")
+    endif()
+    set(${out} ${settings} PARENT_SCOPE)
+endfunction()
+
+function(run_checked)
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE rc)
+    if(NOT rc EQUAL 0)
+        string(REPLACE ";" " " command "${ARGN}")
+        message(FATAL_ERROR "PerfReport: '${command}' failed (${rc})")
+    endif()
+endfunction()
+
+function(configure_and_build dir settings)
+    run_checked(${CMAKE_COMMAND} -S ${SOURCE_DIR} -B ${dir} -G ${GENERATOR}
+                -DCMAKE_CXX_COMPILER=${CXX_COMPILER} -DCMAKE_BUILD_TYPE=Release
+                -DCOLINEAR_BUILD_BENCHMARKS=ON -DCOLINEAR_TRIG_LUT=${TRIG_LUT}
+                -DCOLINEAR_NATIVE=OFF -DCOLINEAR_LTO=OFF -DCOLINEAR_FP_MODEL=default -DCOLINEAR_PGO=OFF
+                ${settings})
+    run_checked(${CMAKE_COMMAND} --build ${dir} --config Release --target geometry_bench accuracy_harness)
+endfunction()
+
+# Single- and multi-config generators put executables in different places
+function(find_built dir name out)
+    foreach(candidate ${dir}/${name} ${dir}/${name}.exe ${dir}/Release/${name} ${dir}/Release/${name}.exe)
+        if(EXISTS ${candidate} AND NOT IS_DIRECTORY ${candidate})
+            set(${out} ${candidate} PARENT_SCOPE)
+            return()
+        endif()
+    endforeach()
+    message(FATAL_ERROR "PerfReport: ${name} not found in ${dir}")
+endfunction()
+
+# ============================================
+# Build and run every profile
+# ============================================
+list(GET PROFILES 0 baseline)
+set(rowKeys)
+foreach(profile ${PROFILES})
+    message(STATUS "PerfReport: profile ${profile}")
+    set(dir ${WORK_DIR}/${profile})
+    profile_settings(${profile} settings)
+
+    if(profile STREQUAL "pgo")
+        # Both passes in one directory so GCC finds the profile by object path
+        set(profileDir ${dir}/pgo-profile)
+        file(REMOVE_RECURSE ${profileDir})
+        configure_and_build(${dir} "${settings};-DCOLINEAR_PGO=GENERATE;-DCOLINEAR_PGO_DIR=${profileDir}")
+        find_built(${dir} geometry_bench trainer)
+        run_checked(${trainer} --min-time 0.02 OUTPUT_QUIET)
+        file(GLOB raw ${profileDir}/*.profraw)
+        if(raw)
+            get_filename_component(compilerDir ${CXX_COMPILER} DIRECTORY)
+            find_program(PROFDATA NAMES llvm-profdata HINTS ${compilerDir})
+            if(NOT PROFDATA)
+                message(FATAL_ERROR "PerfReport: llvm-profdata is needed to merge the Clang profile")
+            endif()
+            run_checked(${PROFDATA} merge -output=${profileDir}/default.profdata ${raw})
+        endif()
+        set(settings ${settings} -DCOLINEAR_PGO=USE -DCOLINEAR_PGO_DIR=${profileDir})
+    endif()
+    configure_and_build(${dir} "${settings}")
+    set(settings_${profile} "${settings}")
+
+    find_built(${dir} geometry_bench bench)
+    execute_process(COMMAND ${bench} --csv ${BENCH_ARGS} OUTPUT_FILE ${dir}/bench.csv RESULT_VARIABLE rc)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "PerfReport: geometry_bench failed for ${profile} (${rc})")
+    endif()
+    find_built(${dir} accuracy_harness accuracy)
+    run_checked(${accuracy} --csv --min-time 0 --dump ${dir}/results.bin OUTPUT_QUIET)
+    file(SHA256 ${dir}/results.bin digest_${profile})
+    if(NOT profile STREQUAL baseline)
+        # "compare: D of N values differ, F in finiteness, max abs A, max ulp U[ at ROW]"
+        execute_process(COMMAND ${accuracy} --csv --min-time 0 --compare ${WORK_DIR}/${baseline}/results.bin
+                        OUTPUT_QUIET ERROR_VARIABLE comparison RESULT_VARIABLE rc)
+        if(NOT rc EQUAL 0 OR NOT comparison MATCHES
+           "compare: ([0-9]+) of ([0-9]+) values differ, ([0-9]+) in finiteness, max abs ([^,]+), max ulp ([0-9]+)")
+            message(FATAL_ERROR "PerfReport: accuracy_harness --compare failed for ${profile}: ${comparison}")
+        endif()
+        set(differing_${profile} ${CMAKE_MATCH_1})
+        set(values_${profile} ${CMAKE_MATCH_2})
+        set(nonFinite_${profile} ${CMAKE_MATCH_3})
+        set(maxAbs_${profile} ${CMAKE_MATCH_4})
+        set(maxUlp_${profile} ${CMAKE_MATCH_5})
+        set(worst_${profile} "")
+        if(comparison MATCHES " at ([^\n]+)")
+            set(worst_${profile} " at ${CMAKE_MATCH_1}")
+        endif()
+    endif()
+
+    # kernel,distribution,ns_per_point,mpoints_per_s,cycles_per_point
+    # (kernel names may contain commas, so split from the right)
+    file(STRINGS ${dir}/bench.csv lines)
+    list(REMOVE_AT lines 0)
+    foreach(line ${lines})
+        string(REPLACE "," ";" fields "${line}")
+        list(LENGTH fields count)
+        math(EXPR nsIndex "${count} - 3")
+        math(EXPR distIndex "${count} - 4")
+        list(GET fields ${nsIndex} ns)
+        list(GET fields ${distIndex} dist)
+        list(SUBLIST fields 0 ${distIndex} kernelFields)
+        string(REPLACE ";" "," kernel "${kernelFields}")
+        set(key "${kernel}/${dist}")
+        string(MD5 id "${key}")
+        if(NOT DEFINED key_${id})
+            set(key_${id} "${key}")
+            list(APPEND rowKeys ${id})
+        endif()
+        set(ns_${profile}_${id} ${ns})
+    endforeach()
+endforeach()
+
+# ============================================
+# Report
+# ============================================
+execute_process(COMMAND ${CXX_COMPILER} --version OUTPUT_VARIABLE compilerVersion ERROR_QUIET)
+string(REGEX REPLACE "\n.*" "" compilerVersion "${compilerVersion}")
+cmake_host_system_information(RESULT cpu QUERY PROCESSOR_DESCRIPTION)
+cmake_host_system_information(RESULT cores QUERY NUMBER_OF_PHYSICAL_CORES)
+find_package(Git QUIET)
+set(revision "unknown")
+if(GIT_FOUND)
+    execute_process(COMMAND ${GIT_EXECUTABLE} -C ${SOURCE_DIR} describe --always --dirty
+                    OUTPUT_VARIABLE revision OUTPUT_STRIP_TRAILING_WHITESPACE ERROR_QUIET)
+endif()
+string(REPLACE ";" " " shownArgs "${BENCH_ARGS}")
+string(TIMESTAMP generated "%Y-%m-%d %H:%M:%S UTC" UTC)
+
+set(md "# Build profile report\n\n")
+string(APPEND md "- source: ${revision}\n- compiler: ${compilerVersion}\n")
+string(APPEND md "- host: ${cpu} (${cores} cores)\n- geometry_bench args: --csv ${shownArgs}\n")
+string(APPEND md "- trig LUT: ${TRIG_LUT}\n- generated: ${generated}\n\n")
+string(APPEND md "| profile | CMake settings |\n|---|---|\n")
+foreach(profile ${PROFILES})
+    string(REPLACE ";" " " shown "${settings_${profile}}")
+    string(REGEX REPLACE " ?-DCOLINEAR_PGO_DIR=[^ ]*" "" shown "${shown}")
+    if(shown STREQUAL "")
+        set(shown "(defaults)")
+    endif()
+    string(APPEND md "| ${profile} | `${shown}` |\n")
+endforeach()
+
+string(APPEND md "\nns/point (speedup over ${baseline}):\n\n| kernel/distribution |")
+set(rule "|---|")
+set(csv "kernel/distribution")
+foreach(profile ${PROFILES})
+    string(APPEND md " ${profile} |")
+    string(APPEND rule "---:|")
+    string(APPEND csv ",${profile}")
+    set(speedupSum_${profile} 0)
+    set(speedupCount_${profile} 0)
+endforeach()
+string(APPEND md "\n${rule}\n")
+string(APPEND csv "\n")
+
+# math(EXPR) is integer-only: speedups are computed in thousandths from
+# the %.4f timings, and the summary row is their arithmetic mean.
+foreach(id ${rowKeys})
+    string(REPLACE "|" "\\|" shownKey "${key_${id}}")
+    string(APPEND md "| ${shownKey} |")
+    string(APPEND csv "\"${key_${id}}\"")
+    set(base "${ns_${baseline}_${id}}")
+    foreach(profile ${PROFILES})
+        set(ns "${ns_${profile}_${id}}")
+        string(APPEND csv ",${ns}")
+        if(ns STREQUAL "")
+            string(APPEND md " - |")
+            continue()
+        endif()
+        if(profile STREQUAL baseline OR base STREQUAL "")
+            string(APPEND md " ${ns} |")
+            continue()
+        endif()
+        # Fixed point with 4 decimals: ns strings are printed as %.4f
+        string(REPLACE "." "" baseFixed "${base}")
+        string(REPLACE "." "" nsFixed "${ns}")
+        string(REGEX REPLACE "^0+([0-9])" "\\1" baseFixed "${baseFixed}")
+        string(REGEX REPLACE "^0+([0-9])" "\\1" nsFixed "${nsFixed}")
+        if(nsFixed EQUAL 0)
+            string(APPEND md " ${ns} |")
+            continue()
+        endif()
+        math(EXPR milli "(${baseFixed} * 1000 + ${nsFixed} / 2) / ${nsFixed}")
+        math(EXPR whole "${milli} / 1000")
+        math(EXPR frac "${milli} % 1000 / 10")
+        if(frac LESS 10)
+            set(frac "0${frac}")
+        endif()
+        string(APPEND md " ${ns} (${whole}.${frac}x) |")
+        math(EXPR speedupSum_${profile} "${speedupSum_${profile}} + ${milli}")
+        math(EXPR speedupCount_${profile} "${speedupCount_${profile}} + 1")
+    endforeach()
+    string(APPEND md "\n")
+    string(APPEND csv "\n")
+endforeach()
+
+string(APPEND md "| **mean speedup** |")
+foreach(profile ${PROFILES})
+    if(profile STREQUAL baseline OR speedupCount_${profile} EQUAL 0)
+        string(APPEND md " 1.00x |")
+    else()
+        math(EXPR milli "${speedupSum_${profile}} / ${speedupCount_${profile}}")
+        math(EXPR whole "${milli} / 1000")
+        math(EXPR frac "${milli} % 1000 / 10")
+        if(frac LESS 10)
+            set(frac "0${frac}")
+        endif()
+        string(APPEND md " ${whole}.${frac}x |")
+    endif()
+endforeach()
+string(APPEND md "\n| **results identical to ${baseline}** |")
+foreach(profile ${PROFILES})
+    if(digest_${profile} STREQUAL digest_${baseline})
+        string(APPEND md " yes |")
+    else()
+        string(APPEND md " no |")
+    endif()
+endforeach()
+string(APPEND md "\n| **values differing** |")
+foreach(profile ${PROFILES})
+    if(profile STREQUAL baseline)
+        string(APPEND md " - |")
+    else()
+        string(APPEND md " ${differing_${profile}} of ${values_${profile}} |")
+    endif()
+endforeach()
+string(APPEND md "\n| **max abs difference (max ulp)** |")
+foreach(profile ${PROFILES})
+    if(profile STREQUAL baseline)
+        string(APPEND md " - |")
+    else()
+        string(APPEND md " ${maxAbs_${profile}}${worst_${profile}} (${maxUlp_${profile}}) |")
+    endif()
+endforeach()
+string(APPEND md "\n| **finiteness changed** |")
+foreach(profile ${PROFILES})
+    if(profile STREQUAL baseline)
+        string(APPEND md " - |")
+    else()
+        string(APPEND md " ${nonFinite_${profile}} |")
+    endif()
+endforeach()
+string(APPEND md "\n\nThe last four rows compare the raw double outputs of every accuracy_harness backend ")
+string(APPEND md "(accuracy_harness --dump / --compare) with the ${baseline} build's. Differences in the ")
+string(APPEND md "real-time huge-theta rows are expected to be large in relative terms: those inputs are ")
+string(APPEND md "beyond its reduction's exact range. Run accuracy_harness in a profile's build directory ")
+string(APPEND md "(${WORK_DIR}/<profile>) for the error of each backend against the reference.\n")
+
+file(WRITE ${REPORT_PREFIX}.md "${md}")
+file(WRITE ${REPORT_PREFIX}.csv "${csv}")
+message(STATUS "PerfReport: wrote ${REPORT_PREFIX}.md and ${REPORT_PREFIX}.csv")
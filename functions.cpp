@@ -0,0 +1,187 @@
+#include <iostream>
+#include <string>
+#include <cstdlib> // For system("clear") or system("CLS")
+#include "headerFiLES/functions.hpp"
+#include "headerFiLES/controller.hpp"
+
+// Function to clear the screen
+void clearScreen() {
+    #if defined(_WIN32)
+        system("CLS"); // For Windows
+    #else
+        system("clear"); // For Linux/Unix/MacOS
+    #endif
+}
+
+// Function to display the screen
+void displayScreen(const std::string &title) {
+    clearScreen();
+    std::cout << "=============================\n";
+    std::cout << "       " << title << "       \n";
+    std::cout << "=============================\n";
+    std::cout << "1. Option One: Start the collinear Calc\n";
+    std::cout << "2. Option Two: Boomerang Curve Calculator\n";
+    std::cout << "3. Exit\n";
+    std::cout << "=============================\n";
+    std::cout << "Select an option: ";
+}
+
+void collinearCalc(){
+    clearScreen();
+    double x;
+    double y;
+    double theta;
+    double distance;
+    double newX;
+    double newY;
+    double thetaRadians;
+    std::cout << "Please Enter Current X \n";
+    std::cin >> x;
+    std::cout << "Please Enter Current Y \n";
+    std::cin >> y;
+    std::cout << "Please Enter Current Theta \n";
+    std::cin >> theta;
+    thetaRadians = degreesToRadians(theta);
+    std::cout << "How far travel? (Positive is straight, negative is backwards)";
+    std::cin >> distance;
+
+    newX = x + distance  * cos(thetaRadians);
+    newY = y + distance  * sin(thetaRadians);
+    std::cout << "=============================\n";
+    std::cout << "New Points \n";
+    std::cout << "=============================\n";
+    std::cout << "NEWX: " << newX << "\n";
+    std::cout << "NEWY: " << newY << "\n";
+    std::cout << "=============================\n";
+
+    
+}
+
+// ============================================
+// Boomerang Curve Calculator - User Interface
+// ============================================
+/**
+ * @brief Interactive calculator for boomerang curve colinear points
+ * 
+ * This function provides a user-friendly interface to:
+ * 1. Input current robot state (x, y, theta)
+ * 2. Specify lookahead distance (dlead)
+ * 3. Optionally specify curvature radius
+ * 4. Display the calculated target point on the boomerang curve
+ */
+void curveCalc(){
+    clearScreen();
+    
+    // ========================================
+    // Variable Declarations
+    // ========================================
+    double x;              // Current X position
+    double y;              // Current Y position
+    double theta;          // Current heading (degrees, user input)
+    double thetaRadians;   // Current heading (radians, internal)
+    double dlead;          // Lookahead distance along curve
+    double radius;         // Curvature radius
+    int useCustomRadius;   // Flag for custom radius input
+    BoomerangCarrot target; // Target point plus chord length and bearing
+    
+    // ========================================
+    // Display Header
+    // ========================================
+    std::cout << "========================================\n";
+    std::cout << "   BOOMERANG CURVE COLINEAR CALCULATOR  \n";
+    std::cout << "========================================\n\n";
+    
+    std::cout << "This calculates a target point along a\n";
+    std::cout << "boomerang (circular arc) trajectory.\n\n";
+    
+    // ========================================
+    // User Input: Current State
+    // ========================================
+    std::cout << "--- Current Robot State ---\n";
+    
+    std::cout << "Enter Current X position: ";
+    std::cin >> x;
+    
+    std::cout << "Enter Current Y position: ";
+    std::cin >> y;
+    
+    std::cout << "Enter Current Theta (degrees): ";
+    std::cin >> theta;
+    
+    // Convert theta from degrees to radians
+    thetaRadians = degreesToRadians(theta);
+    
+    // ========================================
+    // User Input: Curve Parameters
+    // ========================================
+    std::cout << "\n--- Boomerang Curve Parameters ---\n";
+    
+    std::cout << "Enter Lookahead Distance (dlead):\n";
+    std::cout << "  (Positive = forward curve, Negative = backward)\n";
+    std::cout << "  dlead: ";
+    std::cin >> dlead;
+    
+    // Ask about custom curvature radius
+    std::cout << "\nUse custom curvature radius? (1=Yes, 0=No): ";
+    std::cin >> useCustomRadius;
+    
+    if (useCustomRadius == 1) {
+        std::cout << "Enter Curvature Radius (larger = gentler curve):\n";
+        std::cout << "  radius: ";
+        std::cin >> radius;
+        
+        // Validate radius input
+        if (radius <= 0) {
+            std::cout << "\nWarning: Radius must be positive. Using default (1.0).\n";
+            radius = DEFAULT_CURVATURE_RADIUS;
+        }
+    } else {
+        radius = DEFAULT_CURVATURE_RADIUS;
+    }
+    
+    // ========================================
+    // Calculate Colinear Point
+    // ========================================
+    target = calculateBoomerangCarrot(makePoseContext(x, y, thetaRadians), dlead, radius);
+    
+    // ========================================
+    // Display Results
+    // ========================================
+    std::cout << "\n========================================\n";
+    std::cout << "         CALCULATION RESULTS            \n";
+    std::cout << "========================================\n";
+    
+    std::cout << "\n--- Input Summary ---\n";
+    std::cout << "  Start Position: (" << x << ", " << y << ")\n";
+    std::cout << "  Heading: " << theta << " degrees (" << thetaRadians << " rad)\n";
+    std::cout << "  Lookahead Distance: " << dlead << "\n";
+    std::cout << "  Curvature Radius: " << radius << "\n";
+    
+    std::cout << "\n--- Target Colinear Point ---\n";
+    std::cout << "  Target X: " << target.carrot.x << "\n";
+    std::cout << "  Target Y: " << target.carrot.y << "\n";
+    
+    // ========================================
+    // Additional Geometric Information
+    // ========================================
+    // Calculate arc angle for reference
+    double arcAngle = dlead / radius;
+    double arcAngleDegrees = arcAngle * 180.0 / M_PI;
+    
+    // Straight-line distance and bearing from start to target, from the
+    // chord the pipeline already evaluated in the robot frame. A target
+    // that did not move (|dlead| < MIN_DLEAD) keeps the 0 bearing that
+    // atan2(0, 0) used to give.
+    double chordLength = target.chordLength;
+    double bearingToTarget = chordLength > 0.0
+        ? std::remainder(thetaRadians + target.chordBearing, 2.0 * M_PI)
+        : 0.0;
+    double bearingDegrees = bearingToTarget * 180.0 / M_PI;
+    
+    std::cout << "\n--- Geometry Details ---\n";
+    std::cout << "  Arc Angle Swept: " << arcAngleDegrees << " degrees\n";
+    std::cout << "  Chord Length: " << chordLength << "\n";
+    std::cout << "  Bearing to Target: " << bearingDegrees << " degrees\n";
+    
+    std::cout << "\n========================================\n";
+}
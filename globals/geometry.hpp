@@ -0,0 +1,158 @@
+#pragma once
+#include <cstddef>
+
+// ============================================
+// Point Structure Declaration
+// ============================================
+template <typename T> struct BasicPoint;
+template <typename T> struct BasicPoseContext;
+typedef BasicPoint<double> Point;
+typedef BasicPoseContext<double> PoseContext;
+
+// ============================================
+// Utility Functions
+// ============================================
+constexpr double degreesToRadians(double degrees);
+
+/**
+ * @brief Precompute the heading rotation of a pose
+ * @param x      Current x position
+ * @param y      Current y position
+ * @param theta  Current heading (radians)
+ * @return PoseContext  Position plus cached cos/sin of theta
+ */
+constexpr PoseContext makePoseContext(double x, double y, double theta);
+
+// ============================================
+// Boomerang Curve Functions
+// ============================================
+/**
+ * @brief Calculate colinear point on boomerang curve
+ * @param x       Current x position
+ * @param y       Current y position
+ * @param theta   Current heading (radians)
+ * @param dlead   Lookahead distance along curve
+ * @param radius  Curvature radius (default = 1.0)
+ * @return Point  Target coordinates on boomerang curve
+ */
+constexpr Point calculateColinearPoint(
+    double x,
+    double y,
+    double theta,
+    double dlead,
+    double radius
+);
+
+/**
+ * @brief Calculate colinear point from a precomputed pose context
+ * @param pose    Pose with cached heading rotation
+ * @param dlead   Lookahead distance along curve
+ * @param radius  Curvature radius
+ * @return Point  Target coordinates on boomerang curve
+ */
+constexpr Point calculateColinearPoint(
+    const PoseContext &pose,
+    double dlead,
+    double radius
+);
+
+/**
+ * @brief Calculate colinear point using curvature instead of radius
+ * @param x          Current x position
+ * @param y          Current y position
+ * @param theta      Current heading (radians)
+ * @param dlead      Lookahead distance
+ * @param curvature  Path curvature (1/radius)
+ * @return Point     Target coordinates on boomerang curve
+ */
+constexpr Point calculateColinearPointWithCurvature(
+    double x,
+    double y,
+    double theta,
+    double dlead,
+    double curvature
+);
+
+// ============================================
+// Batch Boomerang Curve Functions
+// ============================================
+/**
+ * @brief Calculate colinear points for a batch of poses (structure of arrays)
+ * @param x       Current x positions
+ * @param y       Current y positions
+ * @param theta   Current headings (radians)
+ * @param dlead   Lookahead distances along curve
+ * @param radius  Curvature radii
+ * @param count   Number of poses in every input/output array
+ * @param outX    Caller-owned output array for target x coordinates
+ * @param outY    Caller-owned output array for target y coordinates
+ */
+inline void calculateColinearPointBatch(
+    const double *x,
+    const double *y,
+    const double *theta,
+    const double *dlead,
+    const double *radius,
+    std::size_t count,
+    double *outX,
+    double *outY
+);
+
+/**
+ * @brief Calculate colinear points for a batch of poses using curvature
+ * @param x          Current x positions
+ * @param y          Current y positions
+ * @param theta      Current headings (radians)
+ * @param dlead      Lookahead distances
+ * @param curvature  Path curvatures (1/radius)
+ * @param count      Number of poses in every input/output array
+ * @param outX       Caller-owned output array for target x coordinates
+ * @param outY       Caller-owned output array for target y coordinates
+ */
+inline void calculateColinearPointWithCurvatureBatch(
+    const double *x,
+    const double *y,
+    const double *theta,
+    const double *dlead,
+    const double *curvature,
+    std::size_t count,
+    double *outX,
+    double *outY
+);
+
+// ============================================
+// Multi-Lookahead Sampling Functions
+// ============================================
+/**
+ * @brief Sample arbitrary lookahead distances from one pose
+ * @param pose    Pose with cached heading rotation
+ * @param dleads  Lookahead distances to sample
+ * @param count   Number of lookahead distances
+ * @param radius  Curvature radius
+ * @param out     Caller-owned output buffer of count points
+ */
+inline void sampleColinearPoints(
+    const PoseContext &pose,
+    const double *dleads,
+    std::size_t count,
+    double radius,
+    Point *out
+);
+
+/**
+ * @brief Sample evenly spaced lookahead distances from one pose
+ * @param pose        Pose with cached heading rotation
+ * @param dleadStart  Lookahead distance of the first sample
+ * @param dleadStep   Lookahead increment between samples
+ * @param count       Number of samples
+ * @param radius      Curvature radius
+ * @param out         Caller-owned output buffer of count points
+ */
+inline void sampleColinearPointsUniform(
+    const PoseContext &pose,
+    double dleadStart,
+    double dleadStep,
+    std::size_t count,
+    double radius,
+    Point *out
+);
@@ -0,0 +1,179 @@
+#pragma once
+#include <cstddef>
+#include "geometry.hpp"
+
+// ============================================
+// Angle Normalization
+// ============================================
+// Odometry headings accumulate without bound (thousands of degrees after
+// a few laps), and calculateColinearPoint() hands theta to sin/cos as is.
+// The helpers below wrap angles into a half-open turn with no libm call and
+// no data-dependent branch: the turn count k comes from the 1.5 * 2^52
+// rounding shift (round to nearest in the default FPU mode, as in
+// ColinearPointCache), followed by one subtraction and two selects that
+// fix the edges of the range.
+//
+// The shift only works if (v + 2^52 * 1.5) - 2^52 * 1.5 is evaluated as
+// written. -ffast-math / -fassociative-math (and /fp:fast) fold it to v,
+// so at runtime the sum goes through shiftedForRounding(), an empty asm
+// statement the optimizer cannot see through; constant evaluation uses
+// the plain expression. Under fast-math the Cody-Waite steps may still be
+// reassociated and lose a few bits over 2^20 turns; k itself stays exact.
+// cache.hpp and realtime.hpp round the same way (tests/fast_math_checks.cpp
+// builds all three with -ffast-math).
+//
+// - Degrees reduce exactly: 360 k is exact and, since the result is close
+//   to the input, so is d - 360 k (for |d| below 2^51 turns).
+// - Radians subtract k * 2 pi with a three-part Cody-Waite split of 2 pi
+//   (the pi/2 split of LutReduction scaled by 4), which keeps the
+//   reduction exact up to 2^20 turns; beyond that the result is still in
+//   range but loses about log2(k) - 20 bits.
+//
+// For headings kept in degrees, wrap before converting: the conversion
+// then only rounds the wrapped angle, so large headings keep full
+// precision and sin/cos always see |theta| <= pi.
+
+// Cody-Waite split of 2 pi: k * hi and k * mid are exact for |k| < 2^20
+constexpr double ANGLE_TWO_PI_HI = 6.28318530693650245667e+00;
+constexpr double ANGLE_TWO_PI_MID = 2.43084020252158639064e-10;
+constexpr double ANGLE_TWO_PI_LO = 8.08906499484466582320e-21;
+
+namespace angle_detail {
+
+// 1.5 * 2^52: adding it leaves round(value) in the low mantissa bits
+constexpr double ROUNDING_SHIFT = 6755399441055744.0;
+
+/**
+ * @brief value + ROUNDING_SHIFT, hidden from value-changing optimizations
+ *
+ * The asm statement is empty (no instruction is emitted) but the compiler
+ * must assume it changes the register, so the sum is rounded to double
+ * and a later "- ROUNDING_SHIFT" cannot be folded away.
+ */
+inline double shiftedForRounding(double value) noexcept {
+    double shifted = value + ROUNDING_SHIFT;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__SSE2_MATH__))
+    __asm__("" : "+x"(shifted));
+#elif defined(__GNUC__) && defined(__aarch64__)
+    __asm__("" : "+w"(shifted));
+#elif defined(__GNUC__)
+    __asm__("" : "+m"(shifted));
+#else
+    volatile double opaque = shifted;
+    shifted = opaque;
+#endif
+    return shifted;
+}
+
+// Rounds to the nearest integer (ties to even) for |value| < 2^51
+constexpr double roundToInteger(double value) {
+    if (COLINEAR_IS_CONSTANT_EVALUATED()) {
+        return (value + ROUNDING_SHIFT) - ROUNDING_SHIFT;
+    }
+    return shiftedForRounding(value) - ROUNDING_SHIFT;
+}
+
+}  // namespace angle_detail
+
+/**
+ * @brief Wraps an angle in radians into [-pi, pi)
+ *
+ * NaN and infinities come back as NaN.
+ */
+constexpr double wrapAngle(double angle) {
+    double k = angle_detail::roundToInteger(angle * (1.0 / (2.0 * M_PI)));
+    double r = ((angle - k * ANGLE_TWO_PI_HI) - k * ANGLE_TWO_PI_MID) - k * ANGLE_TWO_PI_LO;
+    r = r < -M_PI ? r + 2.0 * M_PI : r;
+    return r >= M_PI ? r - 2.0 * M_PI : r;
+}
+
+/**
+ * @brief Wraps an angle in degrees into [-180, 180), exactly
+ */
+constexpr double wrapDegrees(double degrees) {
+    double k = angle_detail::roundToInteger(degrees * (1.0 / 360.0));
+    double r = degrees - k * 360.0;
+    r = r < -180.0 ? r + 360.0 : r;
+    return r >= 180.0 ? r - 360.0 : r;
+}
+
+/**
+ * @brief Heading in degrees to radians in [-pi, pi], reduced in degrees first
+ *
+ * Identical to degreesToRadians() for inputs already in [-180, 180).
+ */
+constexpr double wrappedDegreesToRadians(double degrees) {
+    return degreesToRadians(wrapDegrees(degrees));
+}
+
+// ============================================
+// Batch Angle Kernels
+// ============================================
+// Element-wise versions of the helpers above for structure-of-arrays
+// inputs. The loop bodies are straight-line code, so the compiler can
+// vectorize them; out may be the same array as the input (in place) but
+// must not otherwise overlap it.
+
+inline void wrapAngleBatch(const double *angles, std::size_t count, double *out) {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = wrapAngle(angles[i]);
+    }
+}
+
+inline void wrapDegreesBatch(const double *degrees, std::size_t count, double *out) {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = wrapDegrees(degrees[i]);
+    }
+}
+
+inline void wrappedDegreesToRadiansBatch(const double *degrees, std::size_t count, double *out) {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = wrappedDegreesToRadians(degrees[i]);
+    }
+}
+
+// ============================================
+// Degree-Native Entry Points
+// ============================================
+/**
+ * @brief makePoseContext() with the heading in degrees (any magnitude)
+ */
+constexpr PoseContext makePoseContextDegrees(double x, double y, double thetaDegrees) {
+    return makePoseContext(x, y, wrappedDegreesToRadians(thetaDegrees));
+}
+
+/**
+ * @brief calculateColinearPoint() with the heading in degrees
+ *
+ * The heading is wrapped in degrees before the conversion, so
+ * accumulated odometry headings stay on the short sin/cos path and keep
+ * full precision.
+ *
+ * @param x             Current x position
+ * @param y             Current y position
+ * @param thetaDegrees  Current heading in degrees, any magnitude
+ * @param dlead         Lookahead distance along the curve
+ * @param radius        Curvature radius
+ */
+constexpr Point calculateColinearPointDegrees(
+    double x,
+    double y,
+    double thetaDegrees,
+    double dlead,
+    double radius = DEFAULT_CURVATURE_RADIUS
+) {
+    return calculateColinearPoint(x, y, wrappedDegreesToRadians(thetaDegrees), dlead, radius);
+}
+
+/**
+ * @brief calculateColinearPointWithCurvature() with the heading in degrees
+ */
+constexpr Point calculateColinearPointWithCurvatureDegrees(
+    double x,
+    double y,
+    double thetaDegrees,
+    double dlead,
+    double curvature
+) {
+    return calculateColinearPointWithCurvature(x, y, wrappedDegreesToRadians(thetaDegrees), dlead, curvature);
+}
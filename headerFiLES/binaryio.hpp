@@ -0,0 +1,605 @@
+#pragma once
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+#include "geometry.hpp"
+#include "simd.hpp"
+#include "stream.hpp"
+
+#if defined(_WIN32)
+    #define COLINEAR_HAVE_MMAP 0
+#else
+    #define COLINEAR_HAVE_MMAP 1
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// ============================================
+// Binary Pose Batch Format
+// ============================================
+// Fixed 32-byte little-endian header followed by packed columns:
+//
+//   offset  size  field
+//   0       4     magic "CPCB"
+//   4       2     version (1)
+//   6       1     layout: 0 = poses (x, y, theta, dlead, param), 1 = points (x, y)
+//   7       1     scalar: 0 = float64, 1 = float32
+//   8       1     param:  0 = radius, 1 = curvature (poses only)
+//   9       7     reserved, zero
+//   16      8     count (number of rows)
+//   24      8     reserved, zero
+//   32            column 0 [count], column 1 [count], ...
+//
+// float64 columns start 8-byte aligned, so a mapped file is used in place
+// by the batch functions with no parsing or copying. float32 columns are
+// widened chunk by chunk.
+
+const char BINARY_POSE_MAGIC[4] = {'C', 'P', 'C', 'B'};
+const std::uint16_t BINARY_POSE_VERSION = 1;
+
+// Rows handed to one batch call while walking a mapped file
+const std::size_t BINARY_CHUNK_SIZE = 1 << 16;
+
+enum class BinaryLayout : std::uint8_t {
+    Poses = 0,
+    Points = 1
+};
+
+enum class BinaryScalar : std::uint8_t {
+    Float64 = 0,
+    Float32 = 1
+};
+
+enum class BinaryParam : std::uint8_t {
+    Radius = 0,
+    Curvature = 1
+};
+
+struct BinaryPoseHeader {
+    char magic[4];
+    std::uint16_t version;
+    std::uint8_t layout;
+    std::uint8_t scalar;
+    std::uint8_t param;
+    std::uint8_t reserved[7];
+    std::uint64_t count;
+    std::uint64_t reserved2;
+};
+static_assert(sizeof(BinaryPoseHeader) == 32, "binary pose header must be 32 bytes");
+
+inline std::size_t binaryColumnCount(BinaryLayout layout) {
+    return layout == BinaryLayout::Poses ? 5 : 2;
+}
+
+inline std::size_t binaryScalarSize(BinaryScalar scalar) {
+    return scalar == BinaryScalar::Float64 ? sizeof(double) : sizeof(float);
+}
+
+/**
+ * @brief Largest file this host can create and map (bounded by off_t and size_t)
+ */
+inline std::uint64_t binaryMaxFileSize() {
+    std::uint64_t limit = std::numeric_limits<std::size_t>::max();
+#if COLINEAR_HAVE_MMAP
+    std::uint64_t offsetLimit = static_cast<std::uint64_t>(std::numeric_limits<off_t>::max());
+    limit = offsetLimit < limit ? offsetLimit : limit;
+#endif
+    return limit;
+}
+
+/**
+ * @brief Largest row count whose file size fits binaryMaxFileSize()
+ *
+ * Counts come from untrusted headers and user-supplied sweeps: check
+ * against this before calling binaryFileSize(), whose product would
+ * otherwise wrap around (2^61 + 1 float64 poses "fit" in 72 bytes).
+ */
+inline std::uint64_t binaryMaxRows(BinaryLayout layout, BinaryScalar scalar) {
+    return (binaryMaxFileSize() - sizeof(BinaryPoseHeader)) / (binaryColumnCount(layout) * binaryScalarSize(scalar));
+}
+
+/**
+ * @brief Header plus columns; count must not exceed binaryMaxRows()
+ */
+inline std::uint64_t binaryFileSize(BinaryLayout layout, BinaryScalar scalar, std::uint64_t count) {
+    return sizeof(BinaryPoseHeader) + binaryColumnCount(layout) * binaryScalarSize(scalar) * count;
+}
+
+inline BinaryPoseHeader makeBinaryHeader(BinaryLayout layout, BinaryScalar scalar, BinaryParam param, std::uint64_t count) {
+    BinaryPoseHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, BINARY_POSE_MAGIC, sizeof(header.magic));
+    header.version = BINARY_POSE_VERSION;
+    header.layout = static_cast<std::uint8_t>(layout);
+    header.scalar = static_cast<std::uint8_t>(scalar);
+    header.param = static_cast<std::uint8_t>(param);
+    header.count = count;
+    return header;
+}
+
+// ============================================
+// Memory-Mapped File
+// ============================================
+/**
+ * @brief RAII read-only or read-write file mapping
+ *
+ * Uses mmap on POSIX. On Windows, where this module has no mapping
+ * backend yet, the file is read into memory and written back on close.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ~MappedFile() {
+        close();
+    }
+
+    /**
+     * @brief Maps an existing file read-only
+     */
+    bool openRead(const std::string &path, std::string &error) {
+        close();
+#if COLINEAR_HAVE_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            error = "cannot open '" + path + "'";
+            return false;
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            error = "cannot stat '" + path + "'";
+            return false;
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ > 0) {
+            void *p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                error = "cannot map '" + path + "'";
+                return false;
+            }
+            ::madvise(p, size_, MADV_SEQUENTIAL);
+            data_ = static_cast<unsigned char *>(p);
+        }
+        ::close(fd);
+        return true;
+#else
+        std::FILE *f = std::fopen(path.c_str(), "rb");
+        if (f == nullptr) {
+            error = "cannot open '" + path + "'";
+            return false;
+        }
+        std::fseek(f, 0, SEEK_END);
+        fallback_.resize(static_cast<std::size_t>(std::ftell(f)));
+        std::fseek(f, 0, SEEK_SET);
+        size_ = std::fread(fallback_.data(), 1, fallback_.size(), f);
+        std::fclose(f);
+        data_ = fallback_.data();
+        return true;
+#endif
+    }
+
+    /**
+     * @brief Creates (or truncates) a file of the given size and maps it writable
+     *
+     * The blocks are reserved up front, so a full disk is reported here
+     * instead of raising SIGBUS when the mapping is written. Call finish()
+     * to flush the data before reporting success.
+     */
+    bool create(const std::string &path, std::size_t size, std::string &error) {
+        close();
+        writePath_ = path;
+#if COLINEAR_HAVE_MMAP
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            error = "cannot create '" + path + "'";
+            return false;
+        }
+        if (size > 0 && !reserve(fd, size)) {
+            ::close(fd);
+            error = "cannot reserve " + std::to_string(size) + " bytes for '" + path + "'";
+            return false;
+        }
+        size_ = size;
+        if (size_ > 0) {
+            void *p = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                error = "cannot map '" + path + "'";
+                return false;
+            }
+            data_ = static_cast<unsigned char *>(p);
+        }
+        ::close(fd);
+        return true;
+#else
+        fallback_.assign(size, 0);
+        size_ = size;
+        data_ = fallback_.data();
+        return true;
+#endif
+    }
+
+    /**
+     * @brief Writes a create()d file back to disk and closes it
+     * @return false if the data could not be written
+     */
+    bool finish(std::string &error) {
+        bool ok = unmap(true);
+        if (!ok) {
+            error = "cannot write '" + writePath_ + "'";
+        }
+        writePath_.clear();
+        return ok;
+    }
+
+    /**
+     * @brief Unmaps without reporting write-back errors (see finish())
+     */
+    void close() {
+        unmap(false);
+        writePath_.clear();
+    }
+
+    unsigned char *data() const { return data_; }
+    std::size_t size() const { return size_; }
+
+private:
+#if COLINEAR_HAVE_MMAP
+    /**
+     * @brief Sizes a new file to size bytes with its storage allocated
+     *
+     * posix_fallocate(), or F_PREALLOCATE on macOS, which has no
+     * posix_fallocate(). Where the filesystem cannot preallocate, the file
+     * is extended with ftruncate() and its last byte written, which still
+     * catches a disk that cannot take the final block.
+     */
+    static bool reserve(int fd, std::size_t size) {
+        off_t length = static_cast<off_t>(size);
+    #if defined(__APPLE__)
+        fstore_t store;
+        std::memset(&store, 0, sizeof(store));
+        store.fst_flags = F_ALLOCATEALL;
+        store.fst_posmode = F_PEOFPOSMODE;
+        store.fst_length = length;
+        if (::fcntl(fd, F_PREALLOCATE, &store) == 0) {
+            return ::ftruncate(fd, length) == 0;
+        }
+        if (errno != ENOTSUP && errno != EINVAL) {
+            return false;
+        }
+    #else
+        int result = ::posix_fallocate(fd, 0, length);
+        if (result == 0) {
+            return true;
+        }
+        if (result != EOPNOTSUPP && result != EINVAL) {
+            return false;
+        }
+    #endif
+        const unsigned char zero = 0;
+        return ::ftruncate(fd, length) == 0 && ::pwrite(fd, &zero, 1, length - 1) == 1;
+    }
+#endif
+
+    bool unmap(bool sync) {
+        bool ok = true;
+#if COLINEAR_HAVE_MMAP
+        if (data_ != nullptr) {
+            if (sync) {
+                ok = ::msync(data_, size_, MS_SYNC) == 0;
+            }
+            ok = ::munmap(data_, size_) == 0 && ok;
+        }
+#else
+        if (!writePath_.empty()) {
+            std::FILE *f = std::fopen(writePath_.c_str(), "wb");
+            ok = f != nullptr && std::fwrite(fallback_.data(), 1, fallback_.size(), f) == fallback_.size();
+            ok = f != nullptr && std::fclose(f) == 0 && ok;
+        }
+        fallback_.clear();
+#endif
+        data_ = nullptr;
+        size_ = 0;
+        return ok;
+    }
+
+    unsigned char *data_ = nullptr;
+    std::size_t size_ = 0;
+    std::string writePath_;  // Set by create(), empty for read mappings
+#if !COLINEAR_HAVE_MMAP
+    std::vector<unsigned char> fallback_;
+#endif
+};
+
+// ============================================
+// Header Validation and Writing
+// ============================================
+/**
+ * @brief Validates the header of a mapped binary pose/point file
+ */
+inline bool readBinaryHeader(const MappedFile &file, BinaryPoseHeader &header, std::string &error) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    error = "binary pose files are little-endian; big-endian hosts are not supported";
+    return false;
+#endif
+    if (file.size() < sizeof(BinaryPoseHeader)) {
+        error = "file too small for a binary pose header";
+        return false;
+    }
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, BINARY_POSE_MAGIC, sizeof(header.magic)) != 0) {
+        error = "bad magic (not a CPCB file)";
+        return false;
+    }
+    if (header.version != BINARY_POSE_VERSION) {
+        error = "unsupported version " + std::to_string(header.version);
+        return false;
+    }
+    if (header.layout > 1 || header.scalar > 1 || header.param > 1) {
+        error = "unknown layout, scalar or param code";
+        return false;
+    }
+    BinaryLayout layout = static_cast<BinaryLayout>(header.layout);
+    BinaryScalar scalar = static_cast<BinaryScalar>(header.scalar);
+    if (header.count > binaryMaxRows(layout, scalar)) {
+        error = "row count " + std::to_string(header.count) + " is too large for this host";
+        return false;
+    }
+    std::uint64_t expected = binaryFileSize(layout, scalar, header.count);
+    if (file.size() < expected) {
+        error = "file truncated: expected " + std::to_string(expected) + " bytes";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Writes a binary pose file from double columns
+ *
+ * Convenience for producing input files from tools and tests.
+ */
+inline bool writeBinaryPoses(
+    const std::string &path,
+    const double *x, const double *y, const double *theta,
+    const double *dlead, const double *param, std::size_t count,
+    BinaryScalar scalar, BinaryParam paramKind, std::string &error
+) {
+    if (count > binaryMaxRows(BinaryLayout::Poses, scalar)) {
+        error = "too many poses for one file";
+        return false;
+    }
+    MappedFile file;
+    if (!file.create(path, binaryFileSize(BinaryLayout::Poses, scalar, count), error)) {
+        return false;
+    }
+    BinaryPoseHeader header = makeBinaryHeader(BinaryLayout::Poses, scalar, paramKind, count);
+    std::memcpy(file.data(), &header, sizeof(header));
+    unsigned char *column = file.data() + sizeof(header);
+    std::size_t columnBytes = count * binaryScalarSize(scalar);
+    for (const double *source : {x, y, theta, dlead, param}) {
+        if (scalar == BinaryScalar::Float64) {
+            std::memcpy(column, source, columnBytes);
+        } else {
+            float *dst = reinterpret_cast<float *>(column);
+            for (std::size_t i = 0; i < count; ++i) {
+                dst[i] = static_cast<float>(source[i]);
+            }
+        }
+        column += columnBytes;
+    }
+    return file.finish(error);
+}
+
+// ============================================
+// Binary Batch Driver
+// ============================================
+namespace binary_detail {
+
+/**
+ * @brief True if both paths name the same existing file (hard links and aliases included)
+ */
+inline bool sameFile(const std::string &a, const std::string &b) {
+    if (a == b) {
+        return true;
+    }
+#if COLINEAR_HAVE_MMAP
+    struct stat sa;
+    struct stat sb;
+    return ::stat(a.c_str(), &sa) == 0 && ::stat(b.c_str(), &sb) == 0 &&
+           sa.st_dev == sb.st_dev && sa.st_ino == sb.st_ino;
+#else
+    return false;
+#endif
+}
+
+inline void evaluateChunk(
+    BinaryParam param, bool fast,
+    const double *x, const double *y, const double *theta,
+    const double *dlead, const double *p, std::size_t n,
+    double *outX, double *outY
+) {
+    if (param == BinaryParam::Curvature) {
+        if (fast) {
+            calculateColinearPointWithCurvatureBatchSimd(x, y, theta, dlead, p, n, outX, outY);
+        } else {
+            calculateColinearPointWithCurvatureBatch(x, y, theta, dlead, p, n, outX, outY);
+        }
+    } else {
+        if (fast) {
+            calculateColinearPointBatchSimd(x, y, theta, dlead, p, n, outX, outY);
+        } else {
+            calculateColinearPointBatch(x, y, theta, dlead, p, n, outX, outY);
+        }
+    }
+}
+
+/**
+ * @brief Flushes runBinary()'s output and turns a write-back failure into its exit status
+ */
+inline int finishOutput(MappedFile &out) {
+    std::string error;
+    if (!out.finish(error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    return 0;
+}
+
+}  // namespace binary_detail
+
+/**
+ * @brief Evaluates a mapped binary pose file into a mapped binary point file
+ *
+ * The output uses the input's scalar type. float64 files are processed in
+ * place: the batch kernels read the input mapping and write the output
+ * mapping directly. The radius/curvature interpretation comes from the
+ * file header, not from --mode. The output must be a different file:
+ * creating it truncates, which would pull the mapped input out from under
+ * the kernels (SIGBUS).
+ *
+ * @return 0 on success, 1 on any I/O or format error
+ */
+inline int runBinary(const StreamOptions &options) {
+    std::string error;
+    if (binary_detail::sameFile(options.inputPath, options.outputPath)) {
+        std::fprintf(stderr, "error: --input and --output name the same file\n");
+        return 1;
+    }
+    MappedFile in;
+    BinaryPoseHeader header;
+    if (!in.openRead(options.inputPath, error) || !readBinaryHeader(in, header, error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    if (header.layout != static_cast<std::uint8_t>(BinaryLayout::Poses)) {
+        std::fprintf(stderr, "error: input is not a pose file\n");
+        return 1;
+    }
+
+    BinaryScalar scalar = static_cast<BinaryScalar>(header.scalar);
+    BinaryParam param = static_cast<BinaryParam>(header.param);
+    std::size_t count = static_cast<std::size_t>(header.count);
+
+    MappedFile out;
+    if (!out.create(options.outputPath, binaryFileSize(BinaryLayout::Points, scalar, count), error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    BinaryPoseHeader outHeader = makeBinaryHeader(BinaryLayout::Points, scalar, param, count);
+    std::memcpy(out.data(), &outHeader, sizeof(outHeader));
+
+    const unsigned char *inColumns = in.data() + sizeof(BinaryPoseHeader);
+    unsigned char *outColumns = out.data() + sizeof(BinaryPoseHeader);
+    std::size_t columnBytes = count * binaryScalarSize(scalar);
+
+    if (scalar == BinaryScalar::Float64) {
+        const double *col[5];
+        for (int c = 0; c < 5; ++c) {
+            col[c] = reinterpret_cast<const double *>(inColumns + c * columnBytes);
+        }
+        double *outX = reinterpret_cast<double *>(outColumns);
+        double *outY = reinterpret_cast<double *>(outColumns + columnBytes);
+        for (std::size_t begin = 0; begin < count; begin += BINARY_CHUNK_SIZE) {
+            std::size_t n = count - begin < BINARY_CHUNK_SIZE ? count - begin : BINARY_CHUNK_SIZE;
+            binary_detail::evaluateChunk(param, options.fast, col[0] + begin, col[1] + begin, col[2] + begin,
+                                         col[3] + begin, col[4] + begin, n, outX + begin, outY + begin);
+        }
+        return binary_detail::finishOutput(out);
+    }
+
+    // float32: widen each chunk into scratch columns, narrow the results
+    const float *col[5];
+    for (int c = 0; c < 5; ++c) {
+        col[c] = reinterpret_cast<const float *>(inColumns + c * columnBytes);
+    }
+    float *outX = reinterpret_cast<float *>(outColumns);
+    float *outY = reinterpret_cast<float *>(outColumns + columnBytes);
+    std::vector<double> scratch(7 * BINARY_CHUNK_SIZE);
+    double *wide[7];
+    for (int c = 0; c < 7; ++c) {
+        wide[c] = scratch.data() + c * BINARY_CHUNK_SIZE;
+    }
+    for (std::size_t begin = 0; begin < count; begin += BINARY_CHUNK_SIZE) {
+        std::size_t n = count - begin < BINARY_CHUNK_SIZE ? count - begin : BINARY_CHUNK_SIZE;
+        for (int c = 0; c < 5; ++c) {
+            for (std::size_t i = 0; i < n; ++i) {
+                wide[c][i] = col[c][begin + i];
+            }
+        }
+        binary_detail::evaluateChunk(param, options.fast, wide[0], wide[1], wide[2], wide[3], wide[4], n,
+                                     wide[5], wide[6]);
+        for (std::size_t i = 0; i < n; ++i) {
+            outX[begin + i] = static_cast<float>(wide[5][i]);
+            outY[begin + i] = static_cast<float>(wide[6][i]);
+        }
+    }
+    return binary_detail::finishOutput(out);
+}
+
+// ============================================
+// Sweep Output
+// ============================================
+/**
+ * @brief Evaluates a parameter sweep straight into a mapped binary point file
+ *
+ * No input file is involved: the grid comes from the spec and the points
+ * are written into the output mapping in the order documented in
+ * sweep.hpp. The header records the Points layout, so the file reads back
+ * like any runBinary() result. Grids whose file would not fit in off_t
+ * (or whose point count overflows) are rejected before anything is
+ * created.
+ *
+ * @param pool  Thread pool, or nullptr for a serial sweep
+ */
+inline bool writeBinarySweep(
+    const std::string &path, const SweepSpec &spec, BinaryScalar scalar,
+    WorkStealingPool *pool, std::string &error
+) {
+    std::uint64_t count = 0;
+    if (!sweepPointCount(spec, count) || count > binaryMaxRows(BinaryLayout::Points, scalar)) {
+        error = "sweep grid has too many points for one file";
+        return false;
+    }
+    MappedFile out;
+    if (!out.create(path, binaryFileSize(BinaryLayout::Points, scalar, count), error)) {
+        return false;
+    }
+    BinaryPoseHeader header = makeBinaryHeader(BinaryLayout::Points, scalar, BinaryParam::Radius, count);
+    std::memcpy(out.data(), &header, sizeof(header));
+    unsigned char *columns = out.data() + sizeof(BinaryPoseHeader);
+    std::size_t columnBytes = static_cast<std::size_t>(count) * binaryScalarSize(scalar);
+    if (scalar == BinaryScalar::Float64) {
+        evaluateSweep(pool, spec, reinterpret_cast<double *>(columns),
+                      reinterpret_cast<double *>(columns + columnBytes));
+    } else {
+        evaluateSweep(pool, spec, reinterpret_cast<float *>(columns),
+                      reinterpret_cast<float *>(columns + columnBytes));
+    }
+    return out.finish(error);
+}
+
+/**
+ * @brief --sweep entry point: parallel sweep into options.outputPath
+ * @return 0 on success, 1 on an I/O error
+ */
+inline int runSweep(const StreamOptions &options) {
+    WorkStealingPool pool;
+    std::string error;
+    BinaryScalar scalar = options.float32 ? BinaryScalar::Float32 : BinaryScalar::Float64;
+    if (!writeBinarySweep(options.outputPath, options.sweepSpec, scalar, &pool, error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,456 @@
+#pragma once
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "angles.hpp"
+#include "geometry.hpp"
+#include "parallel.hpp"
+
+// ============================================
+// Memoized Colinear Point Queries
+// ============================================
+// Bounded cache for workloads that ask the same question over and over,
+// e.g. simulators whose inputs are already quantized to encoder
+// resolution.
+//
+// The curve only depends on (x, y) through the final translation, so the
+// cache stores the world-frame offset from the start position keyed on
+// the quantized (theta, dlead, radius) tuple and every position shares
+// the entry:
+//
+//   target = (x, y) + offset(theta_q, dlead_q, radius_q)
+//
+// The offset is stored before the EPSILON cleanup, which is applied once
+// to the translated target, and a stay key (|dlead_q| < MIN_DLEAD) returns
+// (x, y) untouched, both as in the direct call.
+//
+// The cache is two-way set-associative: each key hashes to a set of two
+// slots and a miss replaces the less recently used one. Compared with a
+// direct-mapped table this keeps pairs of colliding keys from evicting
+// each other (at a quarter load roughly a fifth of the keys collide),
+// while a lookup is still one multiply-shift hash, two compares and no
+// allocation, locking or list maintenance. Share it between threads
+// through threadLocalColinearCache(), never directly.
+
+// Default number of slots (rounded up to a power of two)
+const std::size_t COLINEAR_CACHE_DEFAULT_CAPACITY = 1 << 16;
+
+// Beyond this many quantization steps (2^51) a value is not cached (also
+// catches NaN/inf); the query is evaluated directly instead
+const double COLINEAR_CACHE_MAX_STEPS = 2251799813685248.0;
+
+/**
+ * @brief Quantization steps of the cache key
+ *
+ * Inputs are rounded to the nearest multiple of their step and the curve
+ * is evaluated at the rounded values, so a hit returns exactly what the
+ * first miss for that key computed. Pick the steps at (or below) the
+ * resolution of the data; for inputs that are already multiples of the
+ * steps the results match the direct call to rounding.
+ */
+struct CacheQuantization {
+    double angle = 1e-4;      // Heading step (radians)
+    double length = 1e-4;     // dlead and radius step
+    double curvature = 1e-6;  // Curvature step (1 / length)
+};
+
+/**
+ * @brief Counters of one cache (or of one parallel call, see below)
+ */
+struct ColinearCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;  // Misses that replaced another key
+    std::uint64_t bypasses = 0;   // Queries outside the key range, not cached
+
+    double hitRate() const {
+        std::uint64_t lookups = hits + misses;
+        return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+    }
+};
+
+/**
+ * @brief Set-associative cache of curve offsets keyed on quantized inputs
+ *
+ * Not thread-safe; use one cache per thread.
+ */
+class ColinearPointCache {
+public:
+    /**
+     * @param capacity  Number of slots (rounded up to a power of two, at least 2)
+     * @param steps     Key quantization
+     */
+    explicit ColinearPointCache(std::size_t capacity = COLINEAR_CACHE_DEFAULT_CAPACITY,
+                                const CacheQuantization &steps = CacheQuantization()) {
+        std::size_t slots = 2;
+        while (slots < capacity) {
+            slots <<= 1;
+        }
+        sets_.resize(slots / 2);
+        mask_ = slots / 2 - 1;
+        setSteps(steps);
+    }
+
+    /**
+     * @brief Cached calculateColinearPoint(x, y, theta, dlead, radius)
+     */
+    Point lookup(double x, double y, double theta, double dlead, double radius = DEFAULT_CURVATURE_RADIUS) {
+        Key key;
+        if (!makeKey(KIND_RADIUS, theta, dlead, radius, inverseSteps_.length, key)) {
+            ++stats_.bypasses;
+            return calculateColinearPoint(x, y, theta, dlead, radius);
+        }
+        Entry *entry = find(key);
+        if (entry == nullptr) {
+            entry = &store(key);
+            setArcOffset(*entry, static_cast<double>(key.theta) * steps_.angle,
+                         static_cast<double>(key.dlead) * steps_.length,
+                         static_cast<double>(key.shape) * steps_.length);
+        }
+        return translate(x, y, *entry);
+    }
+
+    /**
+     * @brief Cached calculateColinearPointWithCurvature(x, y, theta, dlead, curvature)
+     */
+    Point lookupWithCurvature(double x, double y, double theta, double dlead, double curvature) {
+        Key key;
+        if (!makeKey(KIND_CURVATURE, theta, dlead, curvature, inverseSteps_.curvature, key)) {
+            ++stats_.bypasses;
+            return calculateColinearPointWithCurvature(x, y, theta, dlead, curvature);
+        }
+        Entry *entry = find(key);
+        if (entry == nullptr) {
+            entry = &store(key);
+            setCurvatureOffset(*entry, static_cast<double>(key.theta) * steps_.angle,
+                               static_cast<double>(key.dlead) * steps_.length,
+                               static_cast<double>(key.shape) * steps_.curvature);
+        }
+        return translate(x, y, *entry);
+    }
+
+    /**
+     * @brief Switches to new quantization steps, dropping every entry if they changed
+     */
+    void setSteps(const CacheQuantization &steps) {
+        if (steps.angle == steps_.angle && steps.length == steps_.length
+            && steps.curvature == steps_.curvature) {
+            return;
+        }
+        steps_ = steps;
+        inverseSteps_.angle = 1.0 / steps.angle;
+        inverseSteps_.length = 1.0 / steps.length;
+        inverseSteps_.curvature = 1.0 / steps.curvature;
+        clear();
+    }
+
+    /**
+     * @brief Drops every entry; the statistics are kept
+     */
+    void clear() {
+        for (Set &set : sets_) {
+            set.ways[0].kind = KIND_EMPTY;
+            set.ways[1].kind = KIND_EMPTY;
+            set.victim = 0;
+        }
+    }
+
+    void resetStats() { stats_ = ColinearCacheStats(); }
+
+    const ColinearCacheStats &stats() const { return stats_; }
+    const CacheQuantization &steps() const { return steps_; }
+    std::size_t capacity() const { return sets_.size() * 2; }
+
+private:
+    enum : std::uint32_t { KIND_EMPTY = 0, KIND_RADIUS = 1, KIND_CURVATURE = 2 };
+
+    // Which of the reference's rules translate() applies to an entry
+    enum : std::uint32_t {
+        RULE_STAY = 0,  // |dlead| < MIN_DLEAD: (x, y) unchanged
+        RULE_LINE = 1,  // Zero curvature: translation only, no cleanup
+        RULE_ARC = 2    // Translation, then the EPSILON cleanup
+    };
+
+    struct Key {
+        std::int64_t theta;
+        std::int64_t dlead;
+        std::int64_t shape;  // Quantized radius or curvature
+        std::uint32_t kind;
+    };
+
+    struct Entry {
+        std::int64_t theta = 0;
+        std::int64_t dlead = 0;
+        std::int64_t shape = 0;
+        std::uint32_t kind = KIND_EMPTY;
+        std::uint32_t rule = RULE_STAY;
+        double offsetX = 0.0;  // Offset from (x, y) before any cleanup
+        double offsetY = 0.0;
+    };
+
+    // Two ways on their own cache lines; victim is the less recently used way
+    struct alignas(64) Set {
+        Entry ways[2];
+        std::uint32_t victim = 0;
+    };
+
+    /**
+     * @brief Rounds value / step to the nearest integer (ties to even)
+     *
+     * Adding and subtracting 1.5 * 2^52 rounds in the FPU's default mode
+     * without a libm call or a sign-dependent branch. The shift needs
+     * strict evaluation order, so it goes through
+     * angle_detail::roundToInteger(), which fast-math cannot fold away.
+     *
+     * @return false if the result is out of range or value is not finite
+     */
+    static bool quantize(double value, double inverseStep, std::int64_t &steps) {
+        double scaled = value * inverseStep;
+        if (!(std::abs(scaled) < COLINEAR_CACHE_MAX_STEPS)) {
+            return false;
+        }
+        steps = static_cast<std::int64_t>(angle_detail::roundToInteger(scaled));
+        return true;
+    }
+
+    /**
+     * @return false if the query must bypass the cache: out of range, or a
+     *         shape that rounds to 0 although the direct call would not
+     *         treat it as 0 (a radius of 3e-5 would turn into the default
+     *         radius, an error of order dlead)
+     */
+    bool makeKey(std::uint32_t kind, double theta, double dlead, double shape, double inverseShapeStep,
+                 Key &key) const {
+        key.kind = kind;
+        return quantize(theta, inverseSteps_.angle, key.theta)
+            && quantize(dlead, inverseSteps_.length, key.dlead)
+            && quantize(shape, inverseShapeStep, key.shape)
+            && (key.shape != 0 || std::abs(shape) < EPSILON);
+    }
+
+    Set &setOf(const Key &key) {
+        // Polynomial combine of the fields, then the splitmix64 finalizer;
+        // keys are small grid coordinates, so weaker mixes cluster badly
+        const std::uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+        std::uint64_t h = static_cast<std::uint64_t>(key.theta);
+        h = h * multiplier + static_cast<std::uint64_t>(key.dlead);
+        h = h * multiplier + static_cast<std::uint64_t>(key.shape);
+        h = h * multiplier + key.kind;
+        h ^= h >> 30;
+        h *= 0xBF58476D1CE4E5B9ull;
+        h ^= h >> 27;
+        h *= 0x94D049BB133111EBull;
+        h ^= h >> 31;
+        return sets_[static_cast<std::size_t>(h) & mask_];
+    }
+
+    /**
+     * @brief Entry holding key, or nullptr; counts the hit and updates the LRU state
+     */
+    Entry *find(const Key &key) {
+        Set &set = setOf(key);
+        for (std::uint32_t way = 0; way < 2; ++way) {
+            if (matches(set.ways[way], key)) {
+                set.victim = way ^ 1u;
+                ++stats_.hits;
+                return &set.ways[way];
+            }
+        }
+        return nullptr;
+    }
+
+    static bool matches(const Entry &entry, const Key &key) {
+        return entry.kind == key.kind && entry.theta == key.theta && entry.dlead == key.dlead
+            && entry.shape == key.shape;
+    }
+
+    /**
+     * @brief Claims the victim way for key; the caller fills in the offset
+     */
+    Entry &store(const Key &key) {
+        Set &set = setOf(key);
+        Entry &entry = set.ways[set.victim];
+        set.victim ^= 1u;
+        ++stats_.misses;
+        if (entry.kind != KIND_EMPTY) {
+            ++stats_.evictions;
+        }
+        entry.theta = key.theta;
+        entry.dlead = key.dlead;
+        entry.shape = key.shape;
+        entry.kind = key.kind;
+        return entry;
+    }
+
+    /**
+     * @brief calculateColinearPoint() at the origin, without the EPSILON cleanup
+     *
+     * The cleanup belongs to the translated point, so translate() applies it
+     * once there, as the direct call does.
+     */
+    static void setArcOffset(Entry &entry, double theta, double dlead, double radius) {
+        entry.offsetX = 0.0;
+        entry.offsetY = 0.0;
+        if (std::abs(dlead) < MIN_DLEAD) {
+            entry.rule = RULE_STAY;
+            return;
+        }
+        dlead = dlead > MAX_DLEAD ? MAX_DLEAD : dlead;
+        dlead = dlead < -MAX_DLEAD ? -MAX_DLEAD : dlead;
+        radius = std::abs(radius) < EPSILON ? DEFAULT_CURVATURE_RADIUS : std::abs(radius);
+        double sinTheta;
+        double cosTheta;
+        batch_detail::arcLane(0.0, 0.0, theta, dlead, radius, entry.offsetX, entry.offsetY, sinTheta, cosTheta);
+        entry.rule = RULE_ARC;
+    }
+
+    /**
+     * @brief calculateColinearPointWithCurvature() at the origin, without the EPSILON cleanup
+     */
+    static void setCurvatureOffset(Entry &entry, double theta, double dlead, double curvature) {
+        if (std::abs(curvature) < EPSILON) {
+            double sinTheta;
+            double cosTheta;
+            curveSinCos(theta, sinTheta, cosTheta);
+            entry.offsetX = dlead * cosTheta;
+            entry.offsetY = dlead * sinTheta;
+            entry.rule = RULE_LINE;
+            return;
+        }
+        setArcOffset(entry, theta, curvature < 0.0 ? -dlead : dlead, 1.0 / std::abs(curvature));
+    }
+
+    // Same early return and EPSILON cleanup as calculateColinearPoint()
+    static Point translate(double x, double y, const Entry &entry) {
+        if (entry.rule == RULE_STAY) {
+            return Point{x, y};
+        }
+        Point result;
+        result.x = x + entry.offsetX;
+        result.y = y + entry.offsetY;
+        if (entry.rule == RULE_LINE) {
+            return result;
+        }
+        if (std::abs(result.x) < EPSILON) {
+            result.x = 0.0;
+        }
+        if (std::abs(result.y) < EPSILON) {
+            result.y = 0.0;
+        }
+        return result;
+    }
+
+    std::vector<Set> sets_;
+    std::size_t mask_ = 0;  // Set count - 1
+    CacheQuantization steps_{0.0, 0.0, 0.0};
+    CacheQuantization inverseSteps_{0.0, 0.0, 0.0};
+    ColinearCacheStats stats_;
+};
+
+/**
+ * @brief Per-thread cache with the default capacity
+ *
+ * Workers of the parallel batch engine each get their own instance, so
+ * lookups never contend. Entries live until the thread exits.
+ */
+inline ColinearPointCache &threadLocalColinearCache() {
+    thread_local ColinearPointCache cache;
+    return cache;
+}
+
+// ============================================
+// Cached Batch Drivers
+// ============================================
+/**
+ * @brief calculateColinearPointBatch() through a cache
+ */
+inline void cachedColinearPointBatch(
+    ColinearPointCache &cache,
+    const double *x,
+    const double *y,
+    const double *theta,
+    const double *dlead,
+    const double *radius,
+    std::size_t count,
+    double *outX,
+    double *outY
+) {
+    for (std::size_t i = 0; i < count; ++i) {
+        Point p = cache.lookup(x[i], y[i], theta[i], dlead[i], radius[i]);
+        outX[i] = p.x;
+        outY[i] = p.y;
+    }
+}
+
+/**
+ * @brief calculateColinearPointWithCurvatureBatch() through a cache
+ */
+inline void cachedColinearPointWithCurvatureBatch(
+    ColinearPointCache &cache,
+    const double *x,
+    const double *y,
+    const double *theta,
+    const double *dlead,
+    const double *curvature,
+    std::size_t count,
+    double *outX,
+    double *outY
+) {
+    for (std::size_t i = 0; i < count; ++i) {
+        Point p = cache.lookupWithCurvature(x[i], y[i], theta[i], dlead[i], curvature[i]);
+        outX[i] = p.x;
+        outY[i] = p.y;
+    }
+}
+
+/**
+ * @brief Multithreaded cachedColinearPointBatch() on the per-thread caches
+ *
+ * Every worker uses its threadLocalColinearCache(), switched to the given
+ * steps. Because keys fully determine the cached offsets, the output does
+ * not depend on which worker ran which chunk.
+ *
+ * @return Hit/miss counts of this call summed over all workers
+ */
+inline ColinearCacheStats parallelCachedColinearPointBatch(
+    WorkStealingPool &pool,
+    const CacheQuantization &steps,
+    const double *x,
+    const double *y,
+    const double *theta,
+    const double *dlead,
+    const double *radius,
+    std::size_t count,
+    double *outX,
+    double *outY,
+    std::size_t chunkSize = PARALLEL_CHUNK_SIZE
+) {
+    std::atomic<std::uint64_t> hits{0};
+    std::atomic<std::uint64_t> misses{0};
+    std::atomic<std::uint64_t> evictions{0};
+    std::atomic<std::uint64_t> bypasses{0};
+    std::size_t chunk = parallel_detail::alignedChunkSize(chunkSize);
+    std::size_t chunkCount = (count + chunk - 1) / chunk;
+    pool.parallelFor(chunkCount, [&](std::size_t c) {
+        ColinearPointCache &cache = threadLocalColinearCache();
+        cache.setSteps(steps);
+        ColinearCacheStats before = cache.stats();
+        std::size_t begin = c * chunk;
+        std::size_t n = count - begin < chunk ? count - begin : chunk;
+        cachedColinearPointBatch(cache, x + begin, y + begin, theta + begin, dlead + begin, radius + begin, n,
+                                 outX + begin, outY + begin);
+        const ColinearCacheStats &after = cache.stats();
+        hits.fetch_add(after.hits - before.hits, std::memory_order_relaxed);
+        misses.fetch_add(after.misses - before.misses, std::memory_order_relaxed);
+        evictions.fetch_add(after.evictions - before.evictions, std::memory_order_relaxed);
+        bypasses.fetch_add(after.bypasses - before.bypasses, std::memory_order_relaxed);
+    });
+    ColinearCacheStats total;
+    total.hits = hits.load();
+    total.misses = misses.load();
+    total.evictions = evictions.load();
+    total.bypasses = bypasses.load();
+    return total;
+}
@@ -0,0 +1,175 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include "geometry.hpp"
+#include "parallel.hpp"
+
+// ============================================
+// Boomerang Controller Pipeline
+// ============================================
+// The carrot stage of a boomerang motion controller in one pass: for each
+// robot pose the carrot point on the arc (calculateColinearPoint()) and
+// the chord from the pose to it.
+//
+// The chord is the local arc point already needed for the carrot,
+//
+//   chord = (R sin(phi), R (1 - cos(phi)))
+//
+// so its bearing and length cost one atan2 and one sqrt on top of the
+// curve math: no second sincos, no world-frame subtraction and no second
+// pass over the outputs. Up to rounding they equal the bearing and
+// distance computed from the carrot's world coordinates, except where the
+// EPSILON cleanup snapped a carrot coordinate to zero.
+//
+// Both depend only on dlead and the radius, not on the pose: they
+// describe the curve, not where the robot stands relative to some other
+// target. A steering error against a separate goal pose is the caller's
+// subtraction.
+//
+// The chord bearing is measured counterclockwise from the heading. Every
+// arc bends left (local y >= 0), so it lies in [0, pi]: phi / 2 for a
+// forward arc of less than a full turn, above pi / 2 once the carrot is
+// behind the robot (dlead < 0).
+// Lanes that stay put (|dlead| < MIN_DLEAD) report a zero bearing and length.
+
+/**
+ * @brief Carrot point plus the chord from the pose to it
+ */
+struct BoomerangCarrot {
+    Point carrot;               // Target point on the arc
+    double chordBearing = 0.0;  // Chord direction relative to the heading (radians, [0, pi])
+    double chordLength = 0.0;   // Straight-line distance from the pose to the carrot
+};
+
+namespace controller_detail {
+
+/**
+ * @brief One pose through the fused pipeline
+ *
+ * Same MIN_DLEAD / MAX_DLEAD / radius / EPSILON rules as
+ * calculateColinearPointBatch(), written with selects like it.
+ */
+inline void carrotLane(
+    double px,
+    double py,
+    double sinTheta,
+    double cosTheta,
+    double d,
+    double r,
+    double &carrotX,
+    double &carrotY,
+    double &chordBearing,
+    double &chordLength
+) {
+    bool stay = std::abs(d) < MIN_DLEAD;
+    d = d > MAX_DLEAD ? MAX_DLEAD : d;
+    d = d < -MAX_DLEAD ? -MAX_DLEAD : d;
+    r = std::abs(r) < EPSILON ? DEFAULT_CURVATURE_RADIUS : std::abs(r);
+
+    double sinPhi;
+    double cosPhi;
+    curveSinCos(d / r, sinPhi, cosPhi);
+    double localX = r * sinPhi;
+    double localY = r * (1.0 - cosPhi);
+
+    double rx = px + localX * cosTheta - localY * sinTheta;
+    double ry = py + localX * sinTheta + localY * cosTheta;
+    rx = std::abs(rx) < EPSILON ? 0.0 : rx;
+    ry = std::abs(ry) < EPSILON ? 0.0 : ry;
+
+    carrotX = stay ? px : rx;
+    carrotY = stay ? py : ry;
+    chordBearing = stay ? 0.0 : std::atan2(localY, localX);
+    chordLength = stay ? 0.0 : std::sqrt(localX * localX + localY * localY);
+}
+
+}  // namespace controller_detail
+
+/**
+ * @brief Carrot point and chord bearing and length for one pose
+ * @param pose    Robot pose with cached heading rotation
+ * @param dlead   Lookahead distance along the boomerang curve
+ * @param radius  Curvature radius (same fallback rules as calculateColinearPoint())
+ */
+inline BoomerangCarrot calculateBoomerangCarrot(
+    const PoseContext &pose,
+    double dlead,
+    double radius = DEFAULT_CURVATURE_RADIUS
+) {
+    BoomerangCarrot result;
+    controller_detail::carrotLane(pose.x, pose.y, pose.sinTheta, pose.cosTheta, dlead, radius, result.carrot.x,
+                                  result.carrot.y, result.chordBearing, result.chordLength);
+    return result;
+}
+
+/**
+ * @brief Fused controller stage over a batch of robot poses (structure of arrays)
+ *
+ * Carrot coordinates match calculateColinearPointBatch() on the same
+ * inputs; all four outputs are written in the same pass. Outputs are
+ * caller-owned arrays of count values and may not alias the inputs.
+ *
+ * @param x                Robot x positions
+ * @param y                Robot y positions
+ * @param theta            Robot headings (radians)
+ * @param dlead            Lookahead distances along the curve
+ * @param radius           Curvature radii
+ * @param count            Number of poses
+ * @param outCarrotX       Carrot x coordinates
+ * @param outCarrotY       Carrot y coordinates
+ * @param outChordBearing  Chord direction relative to the heading, in [0, pi]
+ * @param outChordLength   Distance from the robot to the carrot
+ */
+inline void boomerangCarrotBatch(
+    const double *x,
+    const double *y,
+    const double *theta,
+    const double *dlead,
+    const double *radius,
+    std::size_t count,
+    double *outCarrotX,
+    double *outCarrotY,
+    double *outChordBearing,
+    double *outChordLength
+) {
+    for (std::size_t i = 0; i < count; ++i) {
+        double sinTheta;
+        double cosTheta;
+        curveSinCos(theta[i], sinTheta, cosTheta);
+        controller_detail::carrotLane(x[i], y[i], sinTheta, cosTheta, dlead[i], radius[i], outCarrotX[i],
+                                      outCarrotY[i], outChordBearing[i], outChordLength[i]);
+    }
+}
+
+/**
+ * @brief Multithreaded boomerangCarrotBatch()
+ *
+ * Output is bit-identical to a single serial call, for any pool size and
+ * chunk size.
+ *
+ * @param pool       Thread pool to run on
+ * @param chunkSize  Poses per work item (rounded up to PARALLEL_CHUNK_ALIGN)
+ */
+inline void parallelBoomerangCarrotBatch(
+    WorkStealingPool &pool,
+    const double *x,
+    const double *y,
+    const double *theta,
+    const double *dlead,
+    const double *radius,
+    std::size_t count,
+    double *outCarrotX,
+    double *outCarrotY,
+    double *outChordBearing,
+    double *outChordLength,
+    std::size_t chunkSize = PARALLEL_CHUNK_SIZE
+) {
+    std::size_t chunk = parallel_detail::alignedChunkSize(chunkSize);
+    std::size_t chunkCount = (count + chunk - 1) / chunk;
+    pool.parallelFor(chunkCount, [&](std::size_t c) {
+        std::size_t begin = c * chunk;
+        std::size_t n = count - begin < chunk ? count - begin : chunk;
+        boomerangCarrotBatch(x + begin, y + begin, theta + begin, dlead + begin, radius + begin, n,
+                             outCarrotX + begin, outCarrotY + begin, outChordBearing + begin, outChordLength + begin);
+    });
+}
@@ -0,0 +1,161 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include "geometry.hpp"
+
+// ============================================
+// Q16.16 Fixed-Point Scalar
+// ============================================
+// 32-bit signed fixed point with 16 fractional bits (range about
+// +/-32768, resolution 1/65536). Meant for controllers without an FPU:
+// every operation, including sin/cos, is integer-only. Arithmetic
+// saturates instead of wrapping so an overflowing arc stays bounded.
+//
+// Use with the templated curve math:
+//   BasicPoint<Fixed16> p = basicColinearPoint(
+//       makeBasicPoseContext(Fixed16(x), Fixed16(y), Fixed16(theta)),
+//       Fixed16(dlead), Fixed16(radius));
+
+struct Fixed16 {
+    std::int32_t raw;
+
+    static const int FRACTION_BITS = 16;
+    static const std::int32_t ONE = 1 << FRACTION_BITS;
+
+    Fixed16() : raw(0) {}
+
+    /**
+     * @brief Converts from double, rounding to nearest and saturating
+     */
+    explicit Fixed16(double value) : raw(0) {
+        double scaled = value * ONE;
+        if (scaled >= 2147483647.0) {
+            raw = std::numeric_limits<std::int32_t>::max();
+        } else if (scaled <= -2147483648.0) {
+            raw = std::numeric_limits<std::int32_t>::min();
+        } else if (scaled == scaled) {  // NaN stays 0
+            raw = static_cast<std::int32_t>(scaled + (scaled >= 0.0 ? 0.5 : -0.5));
+        }
+    }
+
+    static Fixed16 fromRaw(std::int32_t value) {
+        Fixed16 f;
+        f.raw = value;
+        return f;
+    }
+
+    static Fixed16 max() { return fromRaw(std::numeric_limits<std::int32_t>::max()); }
+
+    double toDouble() const { return static_cast<double>(raw) / ONE; }
+
+    static std::int32_t saturate(std::int64_t value) {
+        if (value > std::numeric_limits<std::int32_t>::max()) {
+            return std::numeric_limits<std::int32_t>::max();
+        }
+        if (value < std::numeric_limits<std::int32_t>::min()) {
+            return std::numeric_limits<std::int32_t>::min();
+        }
+        return static_cast<std::int32_t>(value);
+    }
+};
+
+inline Fixed16 operator+(Fixed16 a, Fixed16 b) {
+    return Fixed16::fromRaw(Fixed16::saturate(static_cast<std::int64_t>(a.raw) + b.raw));
+}
+
+inline Fixed16 operator-(Fixed16 a, Fixed16 b) {
+    return Fixed16::fromRaw(Fixed16::saturate(static_cast<std::int64_t>(a.raw) - b.raw));
+}
+
+inline Fixed16 operator-(Fixed16 a) {
+    return Fixed16::fromRaw(Fixed16::saturate(-static_cast<std::int64_t>(a.raw)));
+}
+
+inline Fixed16 operator*(Fixed16 a, Fixed16 b) {
+    std::int64_t product = static_cast<std::int64_t>(a.raw) * b.raw;
+    product += std::int64_t(1) << (Fixed16::FRACTION_BITS - 1);  // Round to nearest
+    return Fixed16::fromRaw(Fixed16::saturate(product >> Fixed16::FRACTION_BITS));
+}
+
+inline Fixed16 operator/(Fixed16 a, Fixed16 b) {
+    if (b.raw == 0) {
+        return a.raw >= 0 ? Fixed16::max() : -Fixed16::max();
+    }
+    std::int64_t numerator = static_cast<std::int64_t>(a.raw) * Fixed16::ONE;
+    return Fixed16::fromRaw(Fixed16::saturate(numerator / b.raw));
+}
+
+inline bool operator<(Fixed16 a, Fixed16 b) { return a.raw < b.raw; }
+inline bool operator>(Fixed16 a, Fixed16 b) { return a.raw > b.raw; }
+inline bool operator<=(Fixed16 a, Fixed16 b) { return a.raw <= b.raw; }
+inline bool operator>=(Fixed16 a, Fixed16 b) { return a.raw >= b.raw; }
+inline bool operator==(Fixed16 a, Fixed16 b) { return a.raw == b.raw; }
+inline bool operator!=(Fixed16 a, Fixed16 b) { return a.raw != b.raw; }
+
+inline Fixed16 abs(Fixed16 a) {
+    return a.raw < 0 ? -a : a;
+}
+
+// ============================================
+// Integer sin/cos for Fixed16
+// ============================================
+// The angle is turned into a 32-bit fraction of a full turn, split into a
+// quadrant and a Q2.30 position inside it, and sin(pi/2 * f) is evaluated
+// with an odd degree-7 least-squares polynomial (max error 6.5e-7, well
+// under one Q16.16 step). cos is the same polynomial at 1 - f.
+namespace fixed16_detail {
+
+// 1 / (2 pi) in Q0.32
+const std::int64_t INV_TWO_PI_Q32 = 683565276;
+
+// sin(pi/2 x) ~ x (C1 + C3 x^2 + C5 x^4 + C7 x^6), coefficients in Q2.30
+const std::int64_t C1 = 1686624950;
+const std::int64_t C3 = -693528462;
+const std::int64_t C5 = 85303417;
+const std::int64_t C7 = -4658781;
+
+inline std::int64_t quarterSinQ30(std::int64_t f) {
+    std::int64_t f2 = (f * f) >> 30;
+    std::int64_t p = C7;
+    p = ((p * f2) >> 30) + C5;
+    p = ((p * f2) >> 30) + C3;
+    p = ((p * f2) >> 30) + C1;
+    return (p * f) >> 30;
+}
+
+inline Fixed16 q30ToFixed(std::int64_t value) {
+    return Fixed16::fromRaw(static_cast<std::int32_t>((value + (1 << 13)) >> 14));
+}
+
+}  // namespace fixed16_detail
+
+/**
+ * @brief Integer-only sin and cos of a Q16.16 angle in radians
+ */
+inline void sinCos(Fixed16 angle, Fixed16 &sinOut, Fixed16 &cosOut) {
+    using namespace fixed16_detail;
+    // Q16.16 * Q0.32 = Q16.48; the low 48 bits are the fraction of a turn
+    std::uint64_t turn48 = static_cast<std::uint64_t>(static_cast<std::int64_t>(angle.raw) * INV_TWO_PI_Q32);
+    std::uint32_t turn = static_cast<std::uint32_t>(turn48 >> 16);
+    unsigned quadrant = turn >> 30;
+    std::int64_t f = turn & 0x3FFFFFFFu;           // Q2.30 position in the quadrant
+    std::int64_t g = (std::int64_t(1) << 30) - f;  // Complement for the cosine
+
+    Fixed16 sf = q30ToFixed(quarterSinQ30(f));
+    Fixed16 sg = q30ToFixed(quarterSinQ30(g));
+    switch (quadrant) {
+        case 0:  sinOut = sf;  cosOut = sg;  break;
+        case 1:  sinOut = sg;  cosOut = -sf; break;
+        case 2:  sinOut = -sf; cosOut = -sg; break;
+        default: sinOut = -sg; cosOut = sf;  break;
+    }
+}
+
+template <>
+struct CurveTraits<Fixed16> {
+    // One LSB: only exact zero counts as "zero" in fixed point
+    static Fixed16 epsilon() { return Fixed16::fromRaw(1); }
+    static Fixed16 minDlead() { return Fixed16::fromRaw(1); }
+    static Fixed16 maxDlead() { return Fixed16::max(); }
+    static Fixed16 defaultRadius() { return Fixed16(DEFAULT_CURVATURE_RADIUS); }
+};
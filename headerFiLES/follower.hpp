@@ -0,0 +1,175 @@
+#pragma once
+#include <cstddef>
+#include "geometry.hpp"
+
+// ============================================
+// Incremental Arc Follower
+// ============================================
+// Stateful counterpart of calculateColinearPoint() for control loops that
+// query the same pose and radius every tick with a slowly changing dlead.
+//
+// The target on the arc is written around the arc center instead of the
+// start pose:
+//
+//   center = (x - R sin(theta), y + R cos(theta))
+//   target = center + R (sin(psi), -cos(psi)),   psi = theta + dlead / R
+//
+// so a tick only rotates (sin psi, cos psi) by the step angle and scales
+// by R. Small steps take sin/cos of the step from a short series instead
+// of the trig backend; the angle is recomputed from scratch every
+// SAMPLE_RESYNC_INTERVAL ticks to bound the drift. Results agree with
+// calculateColinearPoint() to a few ULP of |center| + R.
+
+// Steps with |dlead / R| below this use the series. The first dropped
+// term is |d|^9 / 9! (< 1e-22 here), far below one ULP of 1.0.
+const double ARC_FOLLOWER_SERIES_LIMIT = 1.0 / 64.0;
+
+/**
+ * @brief Follows a target point along one boomerang arc tick by tick
+ *
+ * Typical use from a fixed-rate loop:
+ *
+ *   ArcFollower follower;
+ *   ...
+ *   Point target = follower.update(pose, dlead, radius);
+ *
+ * update() resynchronizes exactly whenever the pose or radius differs from
+ * the previous call and otherwise moves along the cached arc. The
+ * MIN_DLEAD, MAX_DLEAD and EPSILON rules are the same as in
+ * calculateColinearPoint().
+ */
+class ArcFollower {
+public:
+    ArcFollower() {
+        reset(makePoseContext(0.0, 0.0, 0.0), 0.0, DEFAULT_CURVATURE_RADIUS);
+    }
+
+    /**
+     * @brief Starts a new arc and evaluates its point at dlead exactly
+     * @param pose    Start pose with cached heading rotation
+     * @param dlead   Lookahead distance along the arc
+     * @param radius  Curvature radius (same fallback rules as calculateColinearPoint())
+     * @return Point  Target point at dlead
+     */
+    Point reset(const PoseContext &pose, double dlead, double radius = DEFAULT_CURVATURE_RADIUS) {
+        pose_ = pose;
+        requestedRadius_ = radius;
+        radius_ = std::abs(radius) < EPSILON ? DEFAULT_CURVATURE_RADIUS : std::abs(radius);
+        centerX_ = pose.x - radius_ * pose.sinTheta;
+        centerY_ = pose.y + radius_ * pose.cosTheta;
+        stepDlead_ = 0.0;
+        sinStep_ = 0.0;
+        cosStep_ = 1.0;
+        sinceSync_ = SAMPLE_RESYNC_INTERVAL;
+        dlead_ = dlead;
+        return moveTo(dlead);
+    }
+
+    /**
+     * @brief Per-tick entry point: advances along the arc or resynchronizes
+     *
+     * If pose and radius are bit-identical to the previous call the
+     * follower steps from the previous dlead to this one; any change
+     * starts a new arc via reset().
+     */
+    Point update(const PoseContext &pose, double dlead, double radius = DEFAULT_CURVATURE_RADIUS) {
+        if (pose.x != pose_.x || pose.y != pose_.y || pose.cosTheta != pose_.cosTheta
+            || pose.sinTheta != pose_.sinTheta || radius != requestedRadius_) {
+            return reset(pose, dlead, radius);
+        }
+        return moveTo(dlead);
+    }
+
+    /**
+     * @brief Moves the target by deltaDlead of arc length
+     */
+    Point advance(double deltaDlead) {
+        return moveTo(dlead_ + deltaDlead);
+    }
+
+    /**
+     * @brief Moves the target to an absolute lookahead distance on the same arc
+     */
+    Point moveTo(double dlead) {
+        double delta = dlead - dlead_;
+        dlead_ = dlead;
+
+        // Start point and clamp plateau: exact evaluation, resync afterwards
+        if (std::abs(dlead) < MIN_DLEAD || std::abs(dlead) > MAX_DLEAD) {
+            point_ = calculateColinearPoint(pose_, dlead, radius_);
+            sinceSync_ = SAMPLE_RESYNC_INTERVAL;
+            return point_;
+        }
+
+        if (sinceSync_ >= SAMPLE_RESYNC_INTERVAL) {
+            syncAngle();
+        } else {
+            if (delta != stepDlead_) {
+                stepDlead_ = delta;
+                stepTrig(delta / radius_);
+            }
+            double nextSin = sinPsi_ * cosStep_ + cosPsi_ * sinStep_;
+            double nextCos = cosPsi_ * cosStep_ - sinPsi_ * sinStep_;
+            sinPsi_ = nextSin;
+            cosPsi_ = nextCos;
+            ++sinceSync_;
+        }
+
+        point_.x = centerX_ + radius_ * sinPsi_;
+        point_.y = centerY_ - radius_ * cosPsi_;
+        if (std::abs(point_.x) < EPSILON) {
+            point_.x = 0.0;
+        }
+        if (std::abs(point_.y) < EPSILON) {
+            point_.y = 0.0;
+        }
+        return point_;
+    }
+
+    Point point() const { return point_; }
+    double dlead() const { return dlead_; }
+    double radius() const { return radius_; }  // Effective radius after the fallback
+    double centerX() const { return centerX_; }
+    double centerY() const { return centerY_; }
+
+private:
+    /**
+     * @brief Recomputes psi from dlead with a fresh sincos
+     */
+    void syncAngle() {
+        double sinPhi;
+        double cosPhi;
+        curveSinCos(dlead_ / radius_, sinPhi, cosPhi);
+        // psi = theta + phi, from the cached heading rotation
+        sinPsi_ = pose_.sinTheta * cosPhi + pose_.cosTheta * sinPhi;
+        cosPsi_ = pose_.cosTheta * cosPhi - pose_.sinTheta * sinPhi;
+        sinceSync_ = 1;
+    }
+
+    /**
+     * @brief sin/cos of the step angle, by series when the step is small
+     */
+    void stepTrig(double angle) {
+        if (std::abs(angle) >= ARC_FOLLOWER_SERIES_LIMIT) {
+            curveSinCos(angle, sinStep_, cosStep_);
+            return;
+        }
+        double a2 = angle * angle;
+        sinStep_ = angle * (1.0 + a2 * (-1.0 / 6.0 + a2 * (1.0 / 120.0 + a2 * (-1.0 / 5040.0))));
+        cosStep_ = 1.0 + a2 * (-0.5 + a2 * (1.0 / 24.0 + a2 * (-1.0 / 720.0 + a2 * (1.0 / 40320.0))));
+    }
+
+    PoseContext pose_;
+    double requestedRadius_;  // Radius as passed in, for change detection
+    double radius_;
+    double centerX_;
+    double centerY_;
+    double sinPsi_ = 0.0;
+    double cosPsi_ = 1.0;
+    double dlead_;
+    double stepDlead_;
+    double sinStep_;
+    double cosStep_;
+    std::size_t sinceSync_;
+    Point point_;
+};
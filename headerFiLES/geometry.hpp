@@ -0,0 +1,984 @@
+#pragma once
+#define _USE_MATH_DEFINES
+#include <cmath>
+#include <math.h>
+#include <cstddef> // For std::size_t
+#include <limits>  // For numeric limits
+#include <array>   // For compile-time route tables
+#include "../globals/geometry.hpp"
+#include "instrument.hpp"
+
+// ============================================
+// Boomerang Curve Geometry Core
+// ============================================
+// Header-only, I/O-free part of the calculator: every function here is
+// inline, constexpr or a template, so the header can be included from any
+// number of translation units and the hot path inlines into the caller.
+// The interactive screens live in functions.hpp / functions.cpp.
+
+// ============================================
+// Point Structure for coordinate representation
+// ============================================
+// Templated on the scalar type (double, float, Fixed16); Point is the
+// double instantiation used by the rest of the calculator.
+template <typename T>
+struct BasicPoint {
+    T x;
+    T y;
+};
+
+// ============================================
+// Pose Context for repeated lookahead queries
+// ============================================
+// Caches the heading rotation of a pose so every lookahead sample taken
+// from it reuses the same cos(theta)/sin(theta).
+template <typename T>
+struct BasicPoseContext {
+    T x;
+    T y;
+    T cosTheta;
+    T sinTheta;
+};
+
+// ============================================
+// Constants for numerical stability
+// ============================================
+constexpr double EPSILON = 1e-9;           // Small value for floating-point comparisons
+constexpr double MAX_DLEAD = 1e6;          // Maximum reasonable lookahead distance
+constexpr double MIN_DLEAD = 1e-6;         // Minimum lookahead to avoid division issues
+
+// ============================================
+// Boomerang Curve Parameters
+// ============================================
+// The boomerang curve is modeled as a circular arc that curves back
+// toward the starting heading. The curvature radius determines how
+// tight the curve is.
+constexpr double DEFAULT_CURVATURE_RADIUS = 1.0;  // Default radius of curvature
+
+// ============================================
+// Per-Scalar Numerical Limits
+// ============================================
+// The templated curve math reads its limits from CurveTraits<T> instead of
+// the double constants above, since e.g. 1e-9 is below float resolution
+// and below one Q16.16 step. Fixed16 is specialized in fixed16.hpp.
+template <typename T>
+struct CurveTraits;
+
+template <>
+struct CurveTraits<double> {
+    static constexpr double epsilon() { return EPSILON; }
+    static constexpr double minDlead() { return MIN_DLEAD; }
+    static constexpr double maxDlead() { return MAX_DLEAD; }
+    static constexpr double defaultRadius() { return DEFAULT_CURVATURE_RADIUS; }
+};
+
+template <>
+struct CurveTraits<float> {
+    static constexpr float epsilon() { return 1e-6f; }       // ~8 ULP at 1.0
+    static constexpr float minDlead() { return 1e-6f; }
+    static constexpr float maxDlead() { return 1e6f; }
+    static constexpr float defaultRadius() { return 1.0f; }
+};
+
+constexpr double degreesToRadians(double degrees) {
+    return degrees * M_PI / 180.0;
+}
+
+// ============================================
+// Fused Trigonometry Helpers
+// ============================================
+/**
+ * @brief Computes sin(angle) and cos(angle) in one call
+ * 
+ * Uses the platform's fused sincos when available (glibc, Apple libm),
+ * which shares the argument reduction between both results. Otherwise it
+ * falls back to separate sin/cos calls.
+ */
+inline void sinCos(double angle, double &sinOut, double &cosOut) {
+    #if defined(__GLIBC__) && defined(_GNU_SOURCE)
+        ::sincos(angle, &sinOut, &cosOut);
+    #elif defined(__APPLE__)
+        __sincos(angle, &sinOut, &cosOut);
+    #else
+        sinOut = sin(angle);
+        cosOut = cos(angle);
+    #endif
+}
+
+/**
+ * @brief Single-precision sinCos (sincosf where available)
+ */
+inline void sinCos(float angle, float &sinOut, float &cosOut) {
+    #if defined(__GLIBC__) && defined(_GNU_SOURCE)
+        ::sincosf(angle, &sinOut, &cosOut);
+    #else
+        sinOut = std::sin(angle);
+        cosOut = std::cos(angle);
+    #endif
+}
+
+// ============================================
+// Compile-Time Trigonometry
+// ============================================
+// libm sin/cos are not constexpr, so curve math evaluated at compile time
+// (e.g. route tables baked into flash) uses this polynomial instead: a
+// three-part Cody-Waite reduction by pi/2 and the fdlibm minimax kernels,
+// accurate to ~2 ULP for |angle| < 1e5. At runtime curveSinCos() still
+// calls the runtime backend, so runtime results are unchanged.
+#if defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+        #define COLINEAR_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #endif
+#endif
+#if !defined(COLINEAR_IS_CONSTANT_EVALUATED) && defined(_MSC_VER) && _MSC_VER >= 1925
+    #define COLINEAR_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#if !defined(COLINEAR_IS_CONSTANT_EVALUATED)
+    // No detection: the curve templates then only work at runtime
+    #define COLINEAR_IS_CONSTANT_EVALUATED() false
+#endif
+
+/**
+ * @brief constexpr sin and cos of a double angle
+ */
+constexpr void constexprSinCos(double angle, double &sinOut, double &cosOut) {
+    double k = angle * 6.36619772367581382433e-01;  // 2/pi
+    k = static_cast<double>(static_cast<long long>(k >= 0.0 ? k + 0.5 : k - 0.5));
+    double r = angle - k * 1.57079632673412561417e+00;
+    r = r - k * 6.07710050630396597660e-11;
+    r = r - k * 2.02226624871116645580e-21;
+    double z = r * r;
+    double sr = r + r * z * (-1.66666666666666324348e-01 + z * (8.33333333332248946124e-03
+              + z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06
+              + z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)))));
+    double cr = 1.0 - 0.5 * z + z * z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03
+              + z * (2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07
+              + z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11)))));
+    long long q = static_cast<long long>(k) & 3;
+    sinOut = (q == 0) ? sr : (q == 1) ? cr : (q == 2) ? -sr : -cr;
+    cosOut = (q == 0) ? cr : (q == 1) ? -sr : (q == 2) ? -cr : sr;
+}
+
+// ============================================
+// Lookup-Table Trigonometry
+// ============================================
+// Optional runtime trig backend for targets where libm sin/cos is slow
+// or has data-dependent latency. A quarter-wave sine table is generated
+// at compile time (so it lands in .rodata / flash) and sampled with
+// linear or quadratic interpolation; cos reads the same table mirrored.
+// Every call costs a Cody-Waite reduction, a few table loads and a
+// handful of FMAs, independent of the angle.
+// The error is absolute, so arc points are only accurate to about
+// radius * maxError; prefer the quadratic order for large radii.
+//
+// Selected with -DCOLINEAR_TRIG_LUT; the table size and interpolation
+// order are set with COLINEAR_TRIG_LUT_SIZE (entries per quarter wave)
+// and COLINEAR_TRIG_LUT_ORDER (1 = linear, 2 = quadratic). Without the
+// flag the tables are still available through lutSinCos().
+#if !defined(COLINEAR_TRIG_LUT_SIZE)
+    #define COLINEAR_TRIG_LUT_SIZE 256
+#endif
+#if !defined(COLINEAR_TRIG_LUT_ORDER)
+    #define COLINEAR_TRIG_LUT_ORDER 2
+#endif
+
+
+/**
+ * @brief sin(i * pi / (2 N)) for i = 0 .. N + 1, built at compile time
+ * 
+ * The extra entry past pi/2 lets the quadratic interpolation read three
+ * consecutive samples anywhere in the quarter.
+ */
+template <typename T, std::size_t N>
+struct QuarterSineTable {
+    static_assert(N >= 4, "lookup table needs at least 4 entries per quarter");
+    T values[N + 2];
+
+    constexpr QuarterSineTable() : values{} {
+        for (std::size_t i = 0; i < N + 2; ++i) {
+            double s = 0.0;
+            double c = 0.0;
+            constexprSinCos(static_cast<double>(i) * (M_PI / 2.0) / static_cast<double>(N), s, c);
+            values[i] = static_cast<T>(s);
+        }
+    }
+};
+
+template <typename T, std::size_t N>
+inline constexpr QuarterSineTable<T, N> QUARTER_SINE_TABLE{};
+
+/**
+ * @brief Worst-case |error| of lutSinCos() for a table of N entries per quarter
+ * 
+ * Interpolation remainder plus a few rounding steps of T, with
+ * h = pi / (2 N) and |sin^(k)| <= 1:
+ * - linear:    h^2 / 8
+ * - quadratic: h^3 / (9 sqrt(3)), about 0.0642 h^3
+ * Holds for |angle| < LutReduction<T>::maxArg().
+ */
+template <typename T, std::size_t N, int Order>
+constexpr double lutSinCosErrorBound() {
+    static_assert(Order == 1 || Order == 2, "interpolation order must be 1 or 2");
+    double h = (M_PI / 2.0) / static_cast<double>(N);
+    double interpolation = Order == 1 ? h * h / 8.0 : h * h * h * 0.0641500299099584;
+    return interpolation + 4.0 * static_cast<double>(std::numeric_limits<T>::epsilon());
+}
+
+/**
+ * @brief Cody-Waite split of pi/2 used to reduce the angle before the lookup
+ *
+ * k * hi and k * mid are exact for every quadrant count k below maxArg(),
+ * so the reduced angle keeps full precision. Larger (or NaN/inf) angles
+ * fall back to sinCos().
+ */
+template <typename T>
+struct LutReduction;
+
+template <>
+struct LutReduction<double> {
+    static constexpr double maxArg() { return 1e5; }
+    static constexpr double hi() { return 1.57079632673412561417e+00; }
+    static constexpr double mid() { return 6.07710050630396597660e-11; }
+    static constexpr double lo() { return 2.02226624871116645580e-21; }
+};
+
+template <>
+struct LutReduction<float> {
+    static constexpr float maxArg() { return 8192.0f; }  // Cephes sinf range
+    static constexpr float hi() { return 1.5703125f; }
+    static constexpr float mid() { return 4.837512969970703125e-4f; }
+    static constexpr float lo() { return 7.54978995489188216e-8f; }
+};
+
+namespace trig_lut_detail {
+
+/**
+ * @brief Interpolates the quarter-wave table at position i + f (0 <= f <= 1)
+ */
+template <typename T, std::size_t N, int Order>
+inline T quarterSine(std::size_t i, T f) {
+    const T *v = QUARTER_SINE_TABLE<T, N>.values;
+    T d1 = v[i + 1] - v[i];
+    if (Order == 1) {
+        return v[i] + f * d1;
+    }
+    // Newton forward form through v[i], v[i + 1], v[i + 2]
+    T d2 = v[i + 2] - T(2.0) * v[i + 1] + v[i];
+    return v[i] + f * (d1 + (f - T(1.0)) * T(0.5) * d2);
+}
+
+}  // namespace trig_lut_detail
+
+/**
+ * @brief Table-driven sin and cos with bounded, angle-independent cost
+ * 
+ * Accuracy is lutSinCosErrorBound<T, N, Order>(): about 1.5e-8 for the
+ * default 256-entry quadratic table and 4.7e-6 for linear.
+ */
+template <typename T, std::size_t N = COLINEAR_TRIG_LUT_SIZE, int Order = COLINEAR_TRIG_LUT_ORDER>
+inline void lutSinCos(T angle, T &sinOut, T &cosOut) {
+    static_assert(Order == 1 || Order == 2, "interpolation order must be 1 or 2");
+    typedef LutReduction<T> Reduction;
+    if (!(std::abs(angle) < Reduction::maxArg())) {
+        sinCos(angle, sinOut, cosOut);
+        return;
+    }
+    // angle = k pi/2 + r with |r| <= pi/4 (casts instead of std::floor,
+    // which is a libm call on targets without a rounding instruction)
+    T t = angle * static_cast<T>(2.0 / M_PI);
+    long long quadrant = static_cast<long long>(t >= T(0.0) ? t + T(0.5) : t - T(0.5));
+    T k = static_cast<T>(quadrant);
+    T r = ((angle - k * Reduction::hi()) - k * Reduction::mid()) - k * Reduction::lo();
+
+    // r in table steps, shifted into [0, N) of the previous quadrant if negative
+    T position = r * static_cast<T>(2.0 * static_cast<double>(N) / M_PI);
+    if (position < T(0.0)) {
+        position += static_cast<T>(N);
+        --quadrant;
+    }
+    std::size_t i = static_cast<std::size_t>(position);
+    T f = position - static_cast<T>(i);
+    if (i >= N) {  // position rounded up to exactly N
+        i = N - 1;
+        f = T(1.0);
+    }
+
+    // sin of the position inside the quadrant, and of its complement
+    T sf = trig_lut_detail::quarterSine<T, N, Order>(i, f);
+    T sg = trig_lut_detail::quarterSine<T, N, Order>(N - 1 - i, T(1.0) - f);
+    // Quadrant q: odd swaps sin and cos, sin flips in q = 2, 3, cos in q = 1, 2
+    bool swap = (quadrant & 1) != 0;
+    T s = swap ? sg : sf;
+    T c = swap ? sf : sg;
+    sinOut = (quadrant & 2) != 0 ? -s : s;
+    cosOut = ((quadrant + 1) & 2) != 0 ? -c : c;
+}
+
+/**
+ * @brief Describes the runtime trig backend the curve math was built with
+ */
+struct TrigBackendInfo {
+    const char *name;       // "libm", "lut-linear" or "lut-quadratic"
+    std::size_t tableSize;  // Entries per quarter wave (0 for libm)
+    int order;              // Interpolation order (0 for libm)
+    double maxError;        // Worst-case |sin/cos error| in double
+};
+
+constexpr TrigBackendInfo trigBackendInfo() {
+    #if defined(COLINEAR_TRIG_LUT)
+        return {COLINEAR_TRIG_LUT_ORDER == 1 ? "lut-linear" : "lut-quadratic", COLINEAR_TRIG_LUT_SIZE,
+                COLINEAR_TRIG_LUT_ORDER,
+                lutSinCosErrorBound<double, COLINEAR_TRIG_LUT_SIZE, COLINEAR_TRIG_LUT_ORDER>()};
+    #else
+        return {"libm", 0, 0, std::numeric_limits<double>::epsilon()};  // ~1 ULP at 1.0
+    #endif
+}
+
+/**
+ * @brief sinCos used by the curve templates
+ * 
+ * Picks constexprSinCos() during constant evaluation. At runtime it calls
+ * the libm based sinCos(), or lutSinCos() when built with
+ * COLINEAR_TRIG_LUT. Other scalar types (Fixed16) are found by ADL.
+ */
+template <typename T>
+constexpr void curveSinCos(T angle, T &sinOut, T &cosOut) {
+    sinCos(angle, sinOut, cosOut);
+}
+
+template <>
+constexpr void curveSinCos<double>(double angle, double &sinOut, double &cosOut) {
+    if (COLINEAR_IS_CONSTANT_EVALUATED()) {
+        constexprSinCos(angle, sinOut, cosOut);
+    } else {
+        #if defined(COLINEAR_TRIG_LUT)
+            lutSinCos(angle, sinOut, cosOut);
+        #else
+            sinCos(angle, sinOut, cosOut);
+        #endif
+    }
+}
+
+template <>
+constexpr void curveSinCos<float>(float angle, float &sinOut, float &cosOut) {
+    if (COLINEAR_IS_CONSTANT_EVALUATED()) {
+        double s = 0.0;
+        double c = 0.0;
+        constexprSinCos(angle, s, c);
+        sinOut = static_cast<float>(s);
+        cosOut = static_cast<float>(c);
+    } else {
+        #if defined(COLINEAR_TRIG_LUT)
+            lutSinCos(angle, sinOut, cosOut);
+        #else
+            sinCos(angle, sinOut, cosOut);
+        #endif
+    }
+}
+
+/**
+ * @brief constexpr absolute value for any scalar type
+ */
+template <typename T>
+constexpr T curveAbs(T value) {
+    return value < T(0.0) ? -value : value;
+}
+
+/**
+ * @brief Builds a pose context with the heading rotation precomputed
+ * @param x      Current x position in world frame
+ * @param y      Current y position in world frame
+ * @param theta  Current heading in radians
+ */
+template <typename T>
+constexpr BasicPoseContext<T> makeBasicPoseContext(T x, T y, T theta) {
+    BasicPoseContext<T> pose{};
+    pose.x = x;
+    pose.y = y;
+    curveSinCos(theta, pose.sinTheta, pose.cosTheta);
+    return pose;
+}
+
+constexpr PoseContext makePoseContext(double x, double y, double theta) {
+    return makeBasicPoseContext<double>(x, y, theta);
+}
+
+// ============================================
+// Boomerang Curve Colinear Point Calculator
+// ============================================
+/**
+ * @brief Colinear point on a boomerang curve for any scalar type
+ * 
+ * Core implementation shared by every precision. See the double
+ * calculateColinearPoint() below for the full geometry; limits come from
+ * CurveTraits<T>. With T = double the result is bit-identical to the
+ * original double implementation.
+ * 
+ * @param pose    Pose with cached cos/sin of the heading
+ * @param dlead   Lookahead distance along the boomerang curve (arc length)
+ * @param radius  Curvature radius of the boomerang
+ * @return BasicPoint<T>  Target (x, y) coordinates on the boomerang curve
+ */
+template <typename T>
+constexpr BasicPoint<T> basicColinearPoint(
+    const BasicPoseContext<T> &pose,
+    T dlead,
+    T radius
+) {
+    typedef CurveTraits<T> Traits;
+    BasicPoint<T> result{};
+    T x = pose.x;
+    T y = pose.y;
+    COLINEAR_COUNT(ArcCall);
+    
+    // ========================================
+    // Input Validation and Bounds Checking
+    // ========================================
+    
+    // Handle edge case: dlead approaches zero
+    // Return current position (no movement along curve)
+    if (curveAbs(dlead) < Traits::minDlead()) {
+        COLINEAR_COUNT(MinDleadReturn);
+        result.x = x;
+        result.y = y;
+        return result;
+    }
+    
+    // Clamp dlead to reasonable bounds for numerical stability
+    if (dlead > Traits::maxDlead()) {
+        COLINEAR_COUNT(MaxDleadClamp);
+        dlead = Traits::maxDlead();
+    } else if (dlead < -Traits::maxDlead()) {
+        COLINEAR_COUNT(MaxDleadClamp);
+        dlead = -Traits::maxDlead();
+    }
+    
+    // Ensure radius is positive and non-zero
+    if (curveAbs(radius) < Traits::epsilon()) {
+        COLINEAR_COUNT(ZeroRadiusFallback);
+        radius = Traits::defaultRadius();
+    }
+    radius = curveAbs(radius);  // Radius must be positive
+    
+    // ========================================
+    // Boomerang Curve Geometry Calculation
+    // ========================================
+    
+    // Calculate the arc angle (phi) swept along the curve
+    // Arc length = radius * angle, so angle = arc_length / radius
+    T phi = dlead / radius;
+    
+    // ========================================
+    // Local Frame Calculation (Robot Frame)
+    // ========================================
+    // In local frame:
+    // - Robot is at origin (0, 0)
+    // - Robot heading is along +X axis
+    // - Curve center is at (0, R) for left turn, (0, -R) for right turn
+    // 
+    // For a boomerang that curves left (positive curvature):
+    // Center of rotation: (0, R)
+    // Point on arc after angle phi:
+    //   local_x = R * sin(phi)
+    //   local_y = R * (1 - cos(phi))
+    //
+    // This creates a smooth arc starting tangent to +X axis
+    
+    // Determine curve direction based on dlead sign
+    // Positive dlead: forward along curve
+    // The boomerang curves to the left by default
+    T sinPhi{};
+    T cosPhi{};
+    curveSinCos(phi, sinPhi, cosPhi);
+    T localX = radius * sinPhi;
+    T localY = radius * (T(1.0) - cosPhi);
+    
+    // ========================================
+    // World Frame Transformation
+    // ========================================
+    // Transform from robot local frame to world frame:
+    // 1. Rotate by theta (current heading)
+    // 2. Translate by (x, y) (current position)
+    //
+    // Rotation matrix for angle theta:
+    // | cos(theta)  -sin(theta) |
+    // | sin(theta)   cos(theta) |
+    //
+    // world_x = x + local_x * cos(theta) - local_y * sin(theta)
+    // world_y = y + local_x * sin(theta) + local_y * cos(theta)
+    
+    // cos(theta) and sin(theta) were computed once in makePoseContext()
+    T cosTheta = pose.cosTheta;
+    T sinTheta = pose.sinTheta;
+    
+    // Apply rotation and translation
+    result.x = x + localX * cosTheta - localY * sinTheta;
+    result.y = y + localX * sinTheta + localY * cosTheta;
+    
+    // ========================================
+    // Numerical Precision Cleanup
+    // ========================================
+    // Clean up very small values that should be zero
+    // This prevents floating-point noise in output
+    if (curveAbs(result.x) < Traits::epsilon()) {
+        COLINEAR_COUNT(EpsilonCleanup);
+        result.x = T(0.0);
+    }
+    if (curveAbs(result.y) < Traits::epsilon()) {
+        COLINEAR_COUNT(EpsilonCleanup);
+        result.y = T(0.0);
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Calculates the colinear point on a boomerang curve trajectory
+ * 
+ * The boomerang curve is a smooth circular arc that:
+ * - Starts at position (x, y) with heading theta
+ * - Curves in a circular arc parameterized by dlead
+ * - Returns a point along this curved path
+ * 
+ * Geometry Explanation:
+ * ---------------------
+ * The boomerang is modeled as motion along a circular arc. Given:
+ * - Current position: (x, y)
+ * - Current heading: theta (radians, 0 = +X axis, counterclockwise positive)
+ * - Lookahead distance: dlead (arc length along the curve)
+ * - Curvature radius: R (determines how tight the curve is)
+ * 
+ * The arc angle swept is: phi = dlead / R
+ * 
+ * In the robot's local frame (heading aligned with +X):
+ * - The curve center is perpendicular to heading at distance R
+ * - Points on the arc are computed using circular geometry
+ * 
+ * Coordinate Frame Transformation:
+ * - Local frame: Robot at origin, heading along +X
+ * - World frame: Actual position and heading
+ * - Transform: Rotate by theta, then translate by (x, y)
+ * 
+ * @param x       Current x position in world frame
+ * @param y       Current y position in world frame
+ * @param theta   Current heading in radians (0 = +X, counterclockwise positive)
+ * @param dlead   Lookahead distance along the boomerang curve (arc length)
+ * @param radius  Curvature radius of the boomerang (optional, default = 1.0)
+ * @return Point  Target (x, y) coordinates on the boomerang curve
+ */
+constexpr Point calculateColinearPoint(
+    double x,
+    double y,
+    double theta,
+    double dlead,
+    double radius = DEFAULT_CURVATURE_RADIUS
+) {
+    COLINEAR_LATENCY_START(start);
+    Point result = basicColinearPoint<double>(makeBasicPoseContext<double>(x, y, theta), dlead, radius);
+    COLINEAR_LATENCY_STOP(ColinearPoint, start);
+    return result;
+}
+
+/**
+ * @brief Colinear point from a precomputed pose context
+ * 
+ * Same geometry as calculateColinearPoint(x, y, theta, ...), but the
+ * heading rotation comes from the context, so evaluating many lookahead
+ * distances from one pose costs a single sincos(phi) per sample.
+ * 
+ * @param pose    Pose with cached cos/sin of the heading
+ * @param dlead   Lookahead distance along the boomerang curve (arc length)
+ * @param radius  Curvature radius of the boomerang (optional, default = 1.0)
+ * @return Point  Target (x, y) coordinates on the boomerang curve
+ */
+constexpr Point calculateColinearPoint(
+    const PoseContext &pose,
+    double dlead,
+    double radius = DEFAULT_CURVATURE_RADIUS
+) {
+    COLINEAR_LATENCY_START(start);
+    Point result = basicColinearPoint<double>(pose, dlead, radius);
+    COLINEAR_LATENCY_STOP(ColinearPoint, start);
+    return result;
+}
+
+/**
+ * @brief Overloaded version with curvature specification
+ * 
+ * This version allows specifying the curvature (1/radius) directly,
+ * which is often more intuitive for motion planning. Templated on the
+ * scalar type like basicColinearPoint(); the double function below is
+ * a thin wrapper.
+ * 
+ * @param x          Current x position
+ * @param y          Current y position
+ * @param theta      Current heading (radians)
+ * @param dlead      Lookahead distance
+ * @param curvature  Curvature of the path (1/radius). Positive = left turn.
+ * @return Point     Target coordinates on boomerang curve
+ */
+template <typename T>
+constexpr BasicPoint<T> basicColinearPointWithCurvature(
+    T x,
+    T y,
+    T theta,
+    T dlead,
+    T curvature
+) {
+    // Convert curvature to radius
+    // Curvature = 1/radius, so radius = 1/curvature
+    // Handle zero curvature (straight line) case
+    COLINEAR_COUNT(CurvatureCall);
+    if (curveAbs(curvature) < CurveTraits<T>::epsilon()) {
+        COLINEAR_COUNT(StraightLine);
+        // Straight line: no curve, just move forward
+        T sinTheta{};
+        T cosTheta{};
+        curveSinCos(theta, sinTheta, cosTheta);
+        BasicPoint<T> result{};
+        result.x = x + dlead * cosTheta;
+        result.y = y + dlead * sinTheta;
+        return result;
+    }
+    
+    T radius = T(1.0) / curveAbs(curvature);
+    
+    // If curvature is negative, flip the dlead to curve right instead of left
+    if (curvature < T(0.0)) {
+        dlead = -dlead;
+    }
+    
+    return basicColinearPoint<T>(makeBasicPoseContext<T>(x, y, theta), dlead, radius);
+}
+
+constexpr Point calculateColinearPointWithCurvature(
+    double x,
+    double y,
+    double theta,
+    double dlead,
+    double curvature
+) {
+    COLINEAR_LATENCY_START(start);
+    Point result = basicColinearPointWithCurvature<double>(x, y, theta, dlead, curvature);
+    COLINEAR_LATENCY_STOP(ColinearPointWithCurvature, start);
+    return result;
+}
+
+// ============================================
+// Compile-Time Route Tables
+// ============================================
+/**
+ * @brief One hard-coded waypoint of an autonomous route
+ */
+struct RouteWaypoint {
+    double x;
+    double y;
+    double theta;    // Heading in radians (degreesToRadians() is constexpr)
+    double dlead;
+    double radius;
+};
+
+/**
+ * @brief Computes the colinear target of every waypoint
+ * 
+ * constexpr, so a fixed route can be evaluated entirely at compile time:
+ * 
+ *   constexpr RouteWaypoint route[] = {{0, 0, 0, 1, 2}, {1, 1, degreesToRadians(90), 1, 2}};
+ *   constexpr auto targets = makeColinearRoute(route);
+ * 
+ * Compile-time values use constexprSinCos() and may differ from the
+ * runtime result by a few ULP.
+ */
+template <std::size_t N>
+constexpr std::array<Point, N> makeColinearRoute(const RouteWaypoint (&waypoints)[N]) {
+    std::array<Point, N> targets{};
+    for (std::size_t i = 0; i < N; ++i) {
+        const RouteWaypoint &w = waypoints[i];
+        targets[i] = basicColinearPoint<double>(makeBasicPoseContext<double>(w.x, w.y, w.theta), w.dlead, w.radius);
+    }
+    return targets;
+}
+
+// ============================================
+// Batch Boomerang Curve Calculator
+// ============================================
+namespace batch_detail {
+
+/**
+ * @brief One lane of the batch kernels: arc point before the EPSILON cleanup
+ *
+ * d must already be clamped and r positive. Also returns the heading
+ * sin/cos, which the curvature kernel's straight-line lanes reuse.
+ */
+inline void arcLane(double px, double py, double theta, double d, double r, double &rx, double &ry,
+                    double &sinTheta, double &cosTheta) {
+    double sinPhi, cosPhi;
+    curveSinCos(d / r, sinPhi, cosPhi);
+    curveSinCos(theta, sinTheta, cosTheta);
+    double localX = r * sinPhi;
+    double localY = r * (1.0 - cosPhi);
+    rx = px + localX * cosTheta - localY * sinTheta;
+    ry = py + localX * sinTheta + localY * cosTheta;
+}
+
+}  // namespace batch_detail
+
+/**
+ * @brief Calculates colinear points for many poses in one call
+ * 
+ * Structure-of-arrays counterpart of calculateColinearPoint(). Every
+ * input is a separate contiguous array of length count, and the results
+ * are written to the caller-owned outX/outY arrays (no allocation).
+ * 
+ * The clamping and cleanup rules are identical to the scalar version:
+ * - |dlead| < MIN_DLEAD returns the start position unchanged
+ * - dlead is clamped to [-MAX_DLEAD, MAX_DLEAD]
+ * - |radius| < EPSILON falls back to DEFAULT_CURVATURE_RADIUS
+ * - results with magnitude below EPSILON are snapped to zero
+ * 
+ * The loop body is written with selects instead of early returns so the
+ * compiler can vectorize it; every lane computes the full arc and the
+ * edge cases are blended in at the end.
+ * 
+ * @param x       Current x positions in world frame
+ * @param y       Current y positions in world frame
+ * @param theta   Current headings in radians
+ * @param dlead   Lookahead distances along the curve (arc length)
+ * @param radius  Curvature radii of the boomerang
+ * @param count   Number of poses in every input/output array
+ * @param outX    Output target x coordinates (may not alias the inputs)
+ * @param outY    Output target y coordinates (may not alias the inputs)
+ */
+inline void calculateColinearPointBatch(
+    const double *x,
+    const double *y,
+    const double *theta,
+    const double *dlead,
+    const double *radius,
+    std::size_t count,
+    double *outX,
+    double *outY
+) {
+    COLINEAR_TALLY_DECLARE(tally);
+    COLINEAR_TALLY(tally, ArcCall, count);
+    for (std::size_t i = 0; i < count; ++i) {
+        double px = x[i];
+        double py = y[i];
+        double d = dlead[i];
+        double r = radius[i];
+        
+        // Same bounds handling as the scalar path, as selects
+        bool stay = std::abs(d) < MIN_DLEAD;
+        COLINEAR_TALLY(tally, MinDleadReturn, stay);
+        COLINEAR_TALLY(tally, MaxDleadClamp, !stay && std::abs(d) > MAX_DLEAD);
+        COLINEAR_TALLY(tally, ZeroRadiusFallback, !stay && std::abs(r) < EPSILON);
+        d = d > MAX_DLEAD ? MAX_DLEAD : d;
+        d = d < -MAX_DLEAD ? -MAX_DLEAD : d;
+        r = std::abs(r) < EPSILON ? DEFAULT_CURVATURE_RADIUS : std::abs(r);
+        
+        // Arc in the local frame, then rotate and translate
+        double rx, ry, sinTheta, cosTheta;
+        batch_detail::arcLane(px, py, theta[i], d, r, rx, ry, sinTheta, cosTheta);
+        
+        // Numerical precision cleanup
+        COLINEAR_TALLY(tally, EpsilonCleanup, !stay && std::abs(rx) < EPSILON);
+        COLINEAR_TALLY(tally, EpsilonCleanup, !stay && std::abs(ry) < EPSILON);
+        rx = std::abs(rx) < EPSILON ? 0.0 : rx;
+        ry = std::abs(ry) < EPSILON ? 0.0 : ry;
+        
+        outX[i] = stay ? px : rx;
+        outY[i] = stay ? py : ry;
+    }
+    COLINEAR_TALLY_PUBLISH(tally);
+}
+
+/**
+ * @brief Batch version of calculateColinearPointWithCurvature()
+ * 
+ * Each lane turns its curvature into a radius and signed dlead in place
+ * and runs the same select-based arc as calculateColinearPointBatch();
+ * zero-curvature lanes blend in the straight-line result instead (no
+ * clamping or cleanup, exactly like the scalar version). Poses are never
+ * handed to another batch call, so the loop stays one vectorizable body
+ * and the branch counters are published once per call.
+ * 
+ * @param x          Current x positions
+ * @param y          Current y positions
+ * @param theta      Current headings (radians)
+ * @param dlead      Lookahead distances
+ * @param curvature  Path curvatures (1/radius). Positive = left turn.
+ * @param count      Number of poses in every input/output array
+ * @param outX       Output target x coordinates
+ * @param outY       Output target y coordinates
+ */
+inline void calculateColinearPointWithCurvatureBatch(
+    const double *x,
+    const double *y,
+    const double *theta,
+    const double *dlead,
+    const double *curvature,
+    std::size_t count,
+    double *outX,
+    double *outY
+) {
+    COLINEAR_TALLY_DECLARE(tally);
+    COLINEAR_TALLY(tally, CurvatureCall, count);
+    for (std::size_t i = 0; i < count; ++i) {
+        double px = x[i];
+        double py = y[i];
+        double c = curvature[i];
+        bool straight = std::abs(c) < EPSILON;
+        
+        // Curvature to radius and signed dlead (negative = right turn);
+        // straight lanes run the arc on a dummy radius and discard it
+        double d = c < 0.0 ? -dlead[i] : dlead[i];
+        double r = straight ? 1.0 : 1.0 / std::abs(c);
+        
+        // calculateColinearPoint() bounds handling for the curved lanes
+        bool stay = !straight && std::abs(d) < MIN_DLEAD;
+        COLINEAR_TALLY(tally, StraightLine, straight);
+        COLINEAR_TALLY(tally, ArcCall, !straight);
+        COLINEAR_TALLY(tally, MinDleadReturn, stay);
+        COLINEAR_TALLY(tally, MaxDleadClamp, !straight && !stay && std::abs(d) > MAX_DLEAD);
+        COLINEAR_TALLY(tally, ZeroRadiusFallback, !straight && !stay && r < EPSILON);
+        d = d > MAX_DLEAD ? MAX_DLEAD : d;
+        d = d < -MAX_DLEAD ? -MAX_DLEAD : d;
+        r = r < EPSILON ? DEFAULT_CURVATURE_RADIUS : r;
+        
+        double rx, ry, sinTheta, cosTheta;
+        batch_detail::arcLane(px, py, theta[i], d, r, rx, ry, sinTheta, cosTheta);
+        
+        COLINEAR_TALLY(tally, EpsilonCleanup, !straight && !stay && std::abs(rx) < EPSILON);
+        COLINEAR_TALLY(tally, EpsilonCleanup, !straight && !stay && std::abs(ry) < EPSILON);
+        rx = std::abs(rx) < EPSILON ? 0.0 : rx;
+        ry = std::abs(ry) < EPSILON ? 0.0 : ry;
+        
+        double lineX = px + dlead[i] * cosTheta;
+        double lineY = py + dlead[i] * sinTheta;
+        outX[i] = straight ? lineX : (stay ? px : rx);
+        outY[i] = straight ? lineY : (stay ? py : ry);
+    }
+    COLINEAR_TALLY_PUBLISH(tally);
+}
+
+// ============================================
+// Multi-Lookahead Sampling
+// ============================================
+// Number of recurrence steps before the arc angle is recomputed with a
+// fresh sincos. Each step adds a few ULP of rotation error, so this
+// bounds the drift to roughly SAMPLE_RESYNC_INTERVAL * 2 ULP of radius.
+const std::size_t SAMPLE_RESYNC_INTERVAL = 32;
+
+/**
+ * @brief Places a point on the arc given the already evaluated arc angle
+ * 
+ * Shared tail of the sampling functions: local arc point, rotation by the
+ * cached heading, translation and EPSILON cleanup, in the same order as
+ * calculateColinearPoint().
+ */
+inline Point arcPointFromTrig(const PoseContext &pose, double radius, double sinPhi, double cosPhi) {
+    double localX = radius * sinPhi;
+    double localY = radius * (1.0 - cosPhi);
+    Point result;
+    result.x = pose.x + localX * pose.cosTheta - localY * pose.sinTheta;
+    result.y = pose.y + localX * pose.sinTheta + localY * pose.cosTheta;
+    if (std::abs(result.x) < EPSILON) {
+        result.x = 0.0;
+    }
+    if (std::abs(result.y) < EPSILON) {
+        result.y = 0.0;
+    }
+    return result;
+}
+
+/**
+ * @brief Samples many lookahead distances from one pose
+ * 
+ * Equivalent to calling calculateColinearPoint(pose, dleads[i], radius)
+ * for every i, but the heading rotation is only evaluated once.
+ * 
+ * @param pose    Pose with cached heading rotation
+ * @param dleads  Lookahead distances to sample
+ * @param count   Number of lookahead distances
+ * @param radius  Curvature radius shared by all samples
+ * @param out     Caller-owned output buffer of count points
+ */
+inline void sampleColinearPoints(
+    const PoseContext &pose,
+    const double *dleads,
+    std::size_t count,
+    double radius,
+    Point *out
+) {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = calculateColinearPoint(pose, dleads[i], radius);
+    }
+}
+
+/**
+ * @brief Samples evenly spaced lookahead distances from one pose
+ * 
+ * Sample i uses dlead = dleadStart + i * dleadStep. Instead of a fresh
+ * sincos per sample, the arc angle is advanced with the rotation
+ * recurrence
+ * 
+ *   sin(phi + dphi) = sin(phi) cos(dphi) + cos(phi) sin(dphi)
+ *   cos(phi + dphi) = cos(phi) cos(dphi) - sin(phi) sin(dphi)
+ * 
+ * and re-synchronized every SAMPLE_RESYNC_INTERVAL samples. Samples that
+ * hit the MIN_DLEAD or MAX_DLEAD limits are evaluated exactly with
+ * calculateColinearPoint() and restart the recurrence.
+ * 
+ * @param pose        Pose with cached heading rotation
+ * @param dleadStart  Lookahead distance of the first sample
+ * @param dleadStep   Lookahead increment between samples
+ * @param count       Number of samples
+ * @param radius      Curvature radius shared by all samples
+ * @param out         Caller-owned output buffer of count points
+ */
+inline void sampleColinearPointsUniform(
+    const PoseContext &pose,
+    double dleadStart,
+    double dleadStep,
+    std::size_t count,
+    double radius,
+    Point *out
+) {
+    // Same radius handling as calculateColinearPoint()
+    if (std::abs(radius) < EPSILON) {
+        radius = DEFAULT_CURVATURE_RADIUS;
+    }
+    radius = std::abs(radius);
+    
+    double sinStep;
+    double cosStep;
+    curveSinCos(dleadStep / radius, sinStep, cosStep);
+    
+    double sinPhi = 0.0;
+    double cosPhi = 1.0;
+    std::size_t sinceSync = SAMPLE_RESYNC_INTERVAL;  // Forces a sync on the first sample
+    
+    for (std::size_t i = 0; i < count; ++i) {
+        double dlead = dleadStart + static_cast<double>(i) * dleadStep;
+        
+        if (std::abs(dlead) < MIN_DLEAD || std::abs(dlead) > MAX_DLEAD) {
+            out[i] = calculateColinearPoint(pose, dlead, radius);
+            sinceSync = SAMPLE_RESYNC_INTERVAL;
+            continue;
+        }
+        
+        if (sinceSync >= SAMPLE_RESYNC_INTERVAL) {
+            curveSinCos(dlead / radius, sinPhi, cosPhi);
+            sinceSync = 0;
+        } else {
+            double nextSin = sinPhi * cosStep + cosPhi * sinStep;
+            double nextCos = cosPhi * cosStep - sinPhi * sinStep;
+            sinPhi = nextSin;
+            cosPhi = nextCos;
+        }
+        ++sinceSync;
+        
+        out[i] = arcPointFromTrig(pose, radius, sinPhi, cosPhi);
+    }
+}
+
@@ -0,0 +1,289 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#if defined(COLINEAR_INSTRUMENT)
+    #include <atomic>
+    #include <chrono>
+    #include <mutex>
+    #include <vector>
+#endif
+
+// ============================================
+// Hot-Path Instrumentation
+// ============================================
+// Branch counters and latency histograms for the curve functions, for
+// finding out in production how often the edge cases fire (and so
+// whether the SIMD kernels pay off).
+//
+// Compiled in with -DCOLINEAR_INSTRUMENT (CMake option of the same name);
+// latency histograms additionally need -DCOLINEAR_INSTRUMENT_LATENCY.
+// Without the macros every hook below expands to nothing and the curve
+// code is unchanged; the snapshot API still exists and reports
+// enabled = false.
+//
+// Counters are per thread: each thread increments its own cache-line
+// aligned block with relaxed loads and stores (no locked instructions),
+// and snapshotCurveCounters() sums every live block plus the totals of
+// threads that have exited. Batch loops tally into locals and publish
+// once per call. The SIMD kernels handle edge cases with lane masks and
+// are only counted per block; lanes of blocks that fall back to the
+// scalar reference are counted individually by it.
+
+enum class CurveEvent : unsigned {
+    ArcCall,             // basicColinearPoint() evaluations (scalar and batch lanes)
+    MinDleadReturn,      // |dlead| < MIN_DLEAD early return
+    MaxDleadClamp,       // dlead clamped to +-MAX_DLEAD
+    ZeroRadiusFallback,  // |radius| < EPSILON replaced by DEFAULT_CURVATURE_RADIUS
+    EpsilonCleanup,      // Result coordinates snapped to zero
+    CurvatureCall,       // basicColinearPointWithCurvature() evaluations (scalar and batch lanes)
+    StraightLine,        // Zero-curvature straight-line branch
+    SimdBlock,           // SIMD blocks evaluated by the vector kernel
+    SimdFallbackBlock,   // SIMD blocks rerun on the scalar reference
+    Count
+};
+
+const std::size_t CURVE_EVENT_COUNT = static_cast<std::size_t>(CurveEvent::Count);
+
+enum class CurveTimer : unsigned {
+    ColinearPoint,               // calculateColinearPoint(), per call
+    ColinearPointWithCurvature,  // calculateColinearPointWithCurvature(), per call
+    SimdBatch,                   // calculateColinearPointBatchSimd(), per call
+    SimdCurvatureBatch,          // calculateColinearPointWithCurvatureBatchSimd(), per call
+    Count
+};
+
+const std::size_t CURVE_TIMER_COUNT = static_cast<std::size_t>(CurveTimer::Count);
+
+// Bucket b holds latencies in [2^b, 2^(b+1)) ns (bucket 0 also holds 0 ns);
+// the last bucket is open-ended
+const std::size_t CURVE_LATENCY_BUCKETS = 32;
+
+inline const char *curveEventName(CurveEvent event) {
+    static const char *names[CURVE_EVENT_COUNT] = {
+        "arc_call", "min_dlead_return", "max_dlead_clamp", "zero_radius_fallback", "epsilon_cleanup",
+        "curvature_call", "straight_line", "simd_block", "simd_fallback_block"};
+    return names[static_cast<std::size_t>(event)];
+}
+
+inline const char *curveTimerName(CurveTimer timer) {
+    static const char *names[CURVE_TIMER_COUNT] = {
+        "calculateColinearPoint", "calculateColinearPointWithCurvature", "calculateColinearPointBatchSimd",
+        "calculateColinearPointWithCurvatureBatchSimd"};
+    return names[static_cast<std::size_t>(timer)];
+}
+
+/**
+ * @brief Totals over all threads at one point in time
+ */
+struct CurveCounterSnapshot {
+    bool enabled = false;         // Built with COLINEAR_INSTRUMENT
+    bool latencyEnabled = false;  // Built with COLINEAR_INSTRUMENT_LATENCY
+    std::uint64_t events[CURVE_EVENT_COUNT] = {};
+    std::uint64_t latency[CURVE_TIMER_COUNT][CURVE_LATENCY_BUCKETS] = {};
+
+    std::uint64_t count(CurveEvent event) const { return events[static_cast<std::size_t>(event)]; }
+};
+
+/**
+ * @brief Per-call tally for batch loops, published with one counter update per event
+ */
+struct CurveTally {
+    std::uint64_t events[CURVE_EVENT_COUNT] = {};
+
+    void add(CurveEvent event, std::uint64_t n) { events[static_cast<std::size_t>(event)] += n; }
+};
+
+#if defined(COLINEAR_INSTRUMENT)
+
+namespace instrument_detail {
+
+struct alignas(64) ThreadCounters {
+    std::atomic<std::uint64_t> events[CURVE_EVENT_COUNT];
+    std::atomic<std::uint64_t> latency[CURVE_TIMER_COUNT][CURVE_LATENCY_BUCKETS];
+
+    ThreadCounters();
+    ~ThreadCounters();
+};
+
+/**
+ * @brief Live thread blocks plus the folded totals of exited threads
+ */
+struct Registry {
+    std::mutex mutex;
+    std::vector<ThreadCounters *> live;
+    CurveCounterSnapshot retired;
+};
+
+inline Registry &registry() {
+    static Registry instance;
+    return instance;
+}
+
+inline void addTo(CurveCounterSnapshot &totals, const ThreadCounters &counters) {
+    for (std::size_t e = 0; e < CURVE_EVENT_COUNT; ++e) {
+        totals.events[e] += counters.events[e].load(std::memory_order_relaxed);
+    }
+    for (std::size_t t = 0; t < CURVE_TIMER_COUNT; ++t) {
+        for (std::size_t b = 0; b < CURVE_LATENCY_BUCKETS; ++b) {
+            totals.latency[t][b] += counters.latency[t][b].load(std::memory_order_relaxed);
+        }
+    }
+}
+
+inline ThreadCounters::ThreadCounters() {
+    for (std::atomic<std::uint64_t> &e : events) {
+        e.store(0, std::memory_order_relaxed);
+    }
+    for (auto &timer : latency) {
+        for (std::atomic<std::uint64_t> &b : timer) {
+            b.store(0, std::memory_order_relaxed);
+        }
+    }
+    Registry &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.live.push_back(this);
+}
+
+inline ThreadCounters::~ThreadCounters() {
+    Registry &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    addTo(r.retired, *this);
+    for (std::size_t i = 0; i < r.live.size(); ++i) {
+        if (r.live[i] == this) {
+            r.live[i] = r.live.back();
+            r.live.pop_back();
+            break;
+        }
+    }
+}
+
+inline ThreadCounters &threadCounters() {
+    thread_local ThreadCounters counters;
+    return counters;
+}
+
+// Only the owning thread writes its block, so load + store is enough
+inline void bump(std::atomic<std::uint64_t> &counter, std::uint64_t n) {
+    counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+}  // namespace instrument_detail
+
+inline void countCurveEvent(CurveEvent event, std::uint64_t n = 1) {
+    instrument_detail::bump(instrument_detail::threadCounters().events[static_cast<std::size_t>(event)], n);
+}
+
+inline void publishCurveTally(const CurveTally &tally) {
+    instrument_detail::ThreadCounters &counters = instrument_detail::threadCounters();
+    for (std::size_t e = 0; e < CURVE_EVENT_COUNT; ++e) {
+        if (tally.events[e] != 0) {
+            instrument_detail::bump(counters.events[e], tally.events[e]);
+        }
+    }
+}
+
+/**
+ * @brief Monotonic timestamp in nanoseconds for the latency hooks
+ */
+inline std::uint64_t curveTimestamp() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+inline void recordCurveLatency(CurveTimer timer, std::uint64_t startNs) {
+    std::uint64_t elapsed = curveTimestamp() - startNs;
+    std::size_t bucket = 0;
+    while (bucket + 1 < CURVE_LATENCY_BUCKETS && (elapsed >> (bucket + 1)) != 0) {
+        ++bucket;
+    }
+    instrument_detail::bump(instrument_detail::threadCounters().latency[static_cast<std::size_t>(timer)][bucket], 1);
+}
+
+inline CurveCounterSnapshot snapshotCurveCounters() {
+    instrument_detail::Registry &r = instrument_detail::registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    CurveCounterSnapshot totals = r.retired;
+    for (const instrument_detail::ThreadCounters *counters : r.live) {
+        instrument_detail::addTo(totals, *counters);
+    }
+    totals.enabled = true;
+    #if defined(COLINEAR_INSTRUMENT_LATENCY)
+        totals.latencyEnabled = true;
+    #endif
+    return totals;
+}
+
+/**
+ * @brief Zeroes every counter
+ *
+ * Increments racing with the reset on other threads may be lost, so
+ * reset between measurement phases rather than during them.
+ */
+inline void resetCurveCounters() {
+    instrument_detail::Registry &r = instrument_detail::registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.retired = CurveCounterSnapshot();
+    for (instrument_detail::ThreadCounters *counters : r.live) {
+        for (std::atomic<std::uint64_t> &e : counters->events) {
+            e.store(0, std::memory_order_relaxed);
+        }
+        for (auto &timer : counters->latency) {
+            for (std::atomic<std::uint64_t> &b : timer) {
+                b.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+    #define COLINEAR_COUNT(event) \
+        (COLINEAR_IS_CONSTANT_EVALUATED() ? (void)0 : countCurveEvent(CurveEvent::event))
+    #define COLINEAR_TALLY_DECLARE(tally) CurveTally tally
+    #define COLINEAR_TALLY(tally, event, n) tally.add(CurveEvent::event, static_cast<std::uint64_t>(n))
+    #define COLINEAR_TALLY_PUBLISH(tally) publishCurveTally(tally)
+#else
+inline CurveCounterSnapshot snapshotCurveCounters() { return CurveCounterSnapshot(); }
+inline void resetCurveCounters() {}
+
+    #define COLINEAR_COUNT(event) ((void)0)
+    #define COLINEAR_TALLY_DECLARE(tally)
+    #define COLINEAR_TALLY(tally, event, n)
+    #define COLINEAR_TALLY_PUBLISH(tally)
+#endif
+
+#if defined(COLINEAR_INSTRUMENT) && defined(COLINEAR_INSTRUMENT_LATENCY)
+    // Deliberately not const: a const integral initializer is tried as a
+    // constant expression first, where the check would read true
+    #define COLINEAR_LATENCY_START(name) \
+        std::uint64_t name = COLINEAR_IS_CONSTANT_EVALUATED() ? 0 : curveTimestamp()
+    #define COLINEAR_LATENCY_STOP(timer, name) \
+        (COLINEAR_IS_CONSTANT_EVALUATED() ? (void)0 : recordCurveLatency(CurveTimer::timer, name))
+#else
+    #define COLINEAR_LATENCY_START(name)
+    #define COLINEAR_LATENCY_STOP(timer, name) ((void)0)
+#endif
+
+/**
+ * @brief Writes a snapshot as "name value" lines (histograms as "timer bucket_ns count")
+ */
+inline void dumpCurveCounters(std::FILE *out, const CurveCounterSnapshot &snapshot = snapshotCurveCounters()) {
+    if (!snapshot.enabled) {
+        std::fprintf(out, "# curve instrumentation disabled (build with COLINEAR_INSTRUMENT)\n");
+        return;
+    }
+    for (std::size_t e = 0; e < CURVE_EVENT_COUNT; ++e) {
+        std::fprintf(out, "%s %llu\n", curveEventName(static_cast<CurveEvent>(e)),
+                     static_cast<unsigned long long>(snapshot.events[e]));
+    }
+    if (!snapshot.latencyEnabled) {
+        return;
+    }
+    for (std::size_t t = 0; t < CURVE_TIMER_COUNT; ++t) {
+        for (std::size_t b = 0; b < CURVE_LATENCY_BUCKETS; ++b) {
+            if (snapshot.latency[t][b] != 0) {
+                std::fprintf(out, "latency %s %llu %llu\n", curveTimerName(static_cast<CurveTimer>(t)),
+                             b == 0 ? 0ull : 1ull << b, static_cast<unsigned long long>(snapshot.latency[t][b]));
+            }
+        }
+    }
+}
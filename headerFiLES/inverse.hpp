@@ -0,0 +1,178 @@
+#pragma once
+#include <cmath>
+#include "geometry.hpp"
+#include "spatial.hpp"
+
+// ============================================
+// Inverse Boomerang Solvers
+// ============================================
+// Closed-form inverses of the forward arc model used by
+// calculateColinearPoint():
+//
+//   local target = (R sin(phi), R (1 - cos(phi))),   phi = dlead / R
+//
+// i.e. every arc starts tangent to the heading and bends to the left of
+// it; negative dlead runs the same circle backwards. (A negative
+// curvature in calculateColinearPointWithCurvature() is the same left
+// circle with dlead negated.) Targets strictly to the right of the
+// heading line are therefore not reachable by any dlead/radius pair.
+//
+// The closed forms are exact in real arithmetic; refineDleadNewton()
+// polishes a dlead against the forward map as compiled (including a
+// lookup-table trig backend) and doubles as the fallback when only a
+// rough starting guess is available. With a table backend the forward
+// map itself is only good to about R * trigBackendInfo().maxError, which
+// bounds how close any solution can get.
+
+// Newton iterations used by the solvers below
+const int INVERSE_NEWTON_ITERATIONS = 8;
+
+/**
+ * @brief Target expressed in the start pose's frame (heading along +X)
+ */
+inline Point toLocalFrame(const PoseContext &pose, const Point &target) {
+    double dx = target.x - pose.x;
+    double dy = target.y - pose.y;
+    Point local;
+    local.x = dx * pose.cosTheta + dy * pose.sinTheta;
+    local.y = -dx * pose.sinTheta + dy * pose.cosTheta;
+    return local;
+}
+
+/**
+ * @brief Newton refinement of dlead so calculateColinearPoint() lands closest to target
+ *
+ * Minimizes |P(dlead) - target|^2 along the arc with the analytic
+ * derivatives P' = unit tangent and P'' = normal / R. Steps are limited
+ * to a quarter turn, and the iteration stops once a step is below
+ * 1e-15 of |dlead| + R or after the given number of iterations.
+ *
+ * @param pose        Start pose with cached heading rotation
+ * @param radius      Curvature radius (same fallback rules as calculateColinearPoint())
+ * @param target      Point to reach
+ * @param dlead       Starting guess
+ * @param iterations  Maximum Newton steps
+ * @return double     Refined lookahead distance
+ */
+inline double refineDleadNewton(
+    const PoseContext &pose,
+    double radius,
+    const Point &target,
+    double dlead,
+    int iterations = INVERSE_NEWTON_ITERATIONS
+) {
+    radius = std::abs(radius) < EPSILON ? DEFAULT_CURVATURE_RADIUS : std::abs(radius);
+    const double maxStep = 0.5 * M_PI * radius;
+    for (int i = 0; i < iterations; ++i) {
+        Point p = calculateColinearPoint(pose, dlead, radius);
+        double sinPhi;
+        double cosPhi;
+        curveSinCos(dlead / radius, sinPhi, cosPhi);
+        // Tangent direction theta + phi, from the cached heading rotation
+        double tx = pose.cosTheta * cosPhi - pose.sinTheta * sinPhi;
+        double ty = pose.sinTheta * cosPhi + pose.cosTheta * sinPhi;
+        double ex = p.x - target.x;
+        double ey = p.y - target.y;
+
+        // f' / 2 = e . t,  f'' / 2 = 1 + e . n / R  with n = (-ty, tx)
+        double gradient = ex * tx + ey * ty;
+        double curvatureTerm = 1.0 + (-ex * ty + ey * tx) / radius;
+        double step = curvatureTerm > 0.0 ? gradient / curvatureTerm : gradient;
+        step = step > maxStep ? maxStep : (step < -maxStep ? -maxStep : step);
+        dlead -= step;
+        if (std::abs(step) <= 1e-15 * (std::abs(dlead) + radius)) {
+            break;
+        }
+    }
+    return dlead;
+}
+
+/**
+ * @brief Arc length to the projection of target onto the arc of the given radius
+ *
+ * Closed form (see projectOntoArc()), taking the revolution with the
+ * smallest |dlead|, i.e. dlead in [-pi R, pi R], then Newton refined.
+ *
+ * @param pose    Start pose with cached heading rotation
+ * @param radius  Curvature radius
+ * @param target  Point to project
+ * @return double Lookahead distance of the closest point on the arc
+ */
+inline double solveDleadForPoint(const PoseContext &pose, double radius, const Point &target) {
+    double r = std::abs(radius) < EPSILON ? DEFAULT_CURVATURE_RADIUS : std::abs(radius);
+    double dlead = projectOntoArc(pose, r, target, -M_PI * r, M_PI * r);
+    return refineDleadNewton(pose, r, target, dlead);
+}
+
+/**
+ * @brief Finds the arc from pose that passes exactly through target
+ *
+ * With the target at (lx, ly) in the pose frame, the tangent circle
+ * through it has
+ *
+ *   curvature = 2 ly / (lx^2 + ly^2)
+ *   dlead     = c * alpha / sin(alpha),  c = |target - start|, alpha = atan2(ly, lx)
+ *
+ * (the swept angle is twice the chord angle alpha). Of the two ways
+ * around that circle the shorter one is returned, so targets behind the
+ * pose get a negative dlead. Targets on the heading line give curvature
+ * 0 and dlead = lx, the straight-line branch of
+ * calculateColinearPointWithCurvature(). The dlead is Newton refined at
+ * the solved radius.
+ *
+ * @param pose       Start pose with cached heading rotation
+ * @param target     Point to reach
+ * @param dlead      Output lookahead distance (|dlead| <= pi / curvature)
+ * @param curvature  Output curvature, >= 0 (left turn) or 0 for a straight line
+ * @return false if the target is right of the heading line or needs |dlead| > MAX_DLEAD
+ */
+inline bool solveArcThroughPoint(const PoseContext &pose, const Point &target, double &dlead, double &curvature) {
+    Point local = toLocalFrame(pose, target);
+    double chord2 = local.x * local.x + local.y * local.y;
+    double chord = std::sqrt(chord2);
+    dlead = 0.0;
+    curvature = 0.0;
+    if (chord < MIN_DLEAD) {
+        return true;  // Already there
+    }
+    // Right of the heading line (beyond rounding of the rotation)
+    if (local.y < -EPSILON * (1.0 + chord)) {
+        return false;
+    }
+    if (local.y <= EPSILON * (1.0 + chord)) {
+        dlead = local.x;  // Straight ahead or straight back
+        return std::abs(dlead) <= MAX_DLEAD;
+    }
+
+    curvature = 2.0 * local.y / chord2;
+    double alpha = std::atan2(local.y, local.x);
+    double sinAlpha = local.y / chord;
+    dlead = chord * alpha / sinAlpha;
+    if (alpha > 0.5 * M_PI) {
+        dlead -= 2.0 * M_PI / curvature;  // Backwards is the shorter way round
+    }
+    if (std::abs(dlead) > MAX_DLEAD) {
+        return false;
+    }
+    dlead = refineDleadNewton(pose, 1.0 / curvature, target, dlead);
+    return true;
+}
+
+/**
+ * @brief Radius form of solveArcThroughPoint()
+ *
+ * A straight-line solution has no finite radius; it is reported as an
+ * infinite radius and has to be evaluated with curvature 0 in
+ * calculateColinearPointWithCurvature().
+ *
+ * @param radius  Output curvature radius (infinite for a straight line)
+ * @return false if the target is not reachable, see solveArcThroughPoint()
+ */
+inline bool solveRadiusThroughPoint(const PoseContext &pose, const Point &target, double &dlead, double &radius) {
+    double curvature;
+    if (!solveArcThroughPoint(pose, target, dlead, curvature)) {
+        return false;
+    }
+    radius = curvature > 0.0 ? 1.0 / curvature : std::numeric_limits<double>::infinity();
+    return true;
+}
@@ -0,0 +1,127 @@
+#pragma once
+#include <cstddef>
+#include "offload_device.hpp"
+#include "parallel.hpp"
+
+// ============================================
+// Batch Offload Backend
+// ============================================
+// Single entry point for very large batches (Monte-Carlo sweeps of 10^9+
+// points). With the CUDA backend compiled in (CMake option COLINEAR_CUDA,
+// which defines the macro of the same name) and a device present, batches
+// are streamed through the GPU; otherwise they run on the CPU parallel
+// batch engine. The choice is made once, when the offloader is created,
+// and a device error during a batch reruns that batch on the CPU.
+//
+// The GPU kernel applies the same MIN_DLEAD / MAX_DLEAD / EPSILON rules
+// as calculateColinearPoint(). Device sincos is within 2 ULP of libm, so
+// results agree with the CPU path to a few ULP, like the SIMD kernels.
+
+/**
+ * @brief Evaluates large batches on the GPU when available, else on the CPU pool
+ *
+ * Not thread-safe: one batch at a time per offloader (the same rule as
+ * WorkStealingPool::parallelFor()).
+ */
+class BatchOffloader {
+public:
+    /**
+     * @param pool         CPU pool for the fallback path
+     * @param allowDevice  false forces the CPU path even if a device exists
+     * @param chunkPoints  Points per device transfer chunk
+     */
+    explicit BatchOffloader(WorkStealingPool &pool, bool allowDevice = true,
+                            std::size_t chunkPoints = OFFLOAD_CHUNK_POINTS)
+        : pool_(pool) {
+        #if defined(COLINEAR_CUDA)
+            if (allowDevice) {
+                device_ = cuda_offload::createContext(chunkPoints);
+            }
+        #else
+            (void)allowDevice;
+            (void)chunkPoints;
+        #endif
+    }
+
+    ~BatchOffloader() {
+        #if defined(COLINEAR_CUDA)
+            cuda_offload::destroyContext(device_);
+        #endif
+    }
+
+    BatchOffloader(const BatchOffloader &) = delete;
+    BatchOffloader &operator=(const BatchOffloader &) = delete;
+
+    /**
+     * @brief true if batches go to a GPU
+     */
+    bool usingDevice() const {
+        #if defined(COLINEAR_CUDA)
+            return device_ != nullptr;
+        #else
+            return false;
+        #endif
+    }
+
+    /**
+     * @brief Device name, or "cpu" for the fallback path
+     */
+    const char *backendName() const {
+        #if defined(COLINEAR_CUDA)
+            if (device_ != nullptr) {
+                return cuda_offload::deviceName(device_);
+            }
+        #endif
+        return "cpu";
+    }
+
+    /**
+     * @brief Offloaded calculateColinearPointBatch()
+     */
+    void colinearPointBatch(
+        const double *x,
+        const double *y,
+        const double *theta,
+        const double *dlead,
+        const double *radius,
+        std::size_t count,
+        double *outX,
+        double *outY
+    ) {
+        #if defined(COLINEAR_CUDA)
+            if (device_ != nullptr
+                && cuda_offload::runBatch(device_, false, x, y, theta, dlead, radius, count, outX, outY)) {
+                return;
+            }
+        #endif
+        parallelColinearPointBatch(pool_, x, y, theta, dlead, radius, count, outX, outY);
+    }
+
+    /**
+     * @brief Offloaded calculateColinearPointWithCurvatureBatch()
+     */
+    void colinearPointWithCurvatureBatch(
+        const double *x,
+        const double *y,
+        const double *theta,
+        const double *dlead,
+        const double *curvature,
+        std::size_t count,
+        double *outX,
+        double *outY
+    ) {
+        #if defined(COLINEAR_CUDA)
+            if (device_ != nullptr
+                && cuda_offload::runBatch(device_, true, x, y, theta, dlead, curvature, count, outX, outY)) {
+                return;
+            }
+        #endif
+        parallelColinearPointWithCurvatureBatch(pool_, x, y, theta, dlead, curvature, count, outX, outY);
+    }
+
+private:
+    WorkStealingPool &pool_;
+    #if defined(COLINEAR_CUDA)
+        cuda_offload::Context *device_ = nullptr;
+    #endif
+};
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+
+// ============================================
+// Device Offload Interface
+// ============================================
+// Functions the CUDA backend (offload_cuda.cu) provides to
+// BatchOffloader. Kept free of the CPU headers so the device compiler
+// only ever sees this file and geometry.hpp.
+
+// Points per transfer chunk: 1M points move 40 MB in and 16 MB out,
+// large enough to saturate PCIe and small enough to double-buffer
+const std::size_t OFFLOAD_CHUNK_POINTS = std::size_t(1) << 20;
+
+namespace cuda_offload {
+
+struct Context;
+
+/**
+ * @brief Picks device 0 and allocates pinned and device buffers for two chunks
+ * @return nullptr if there is no usable device or an allocation fails
+ */
+Context *createContext(std::size_t chunkPoints);
+void destroyContext(Context *context);
+const char *deviceName(const Context *context);
+
+/**
+ * @brief Streams a batch through the device, overlapping copies with compute
+ * @param curvature  true: shape is curvature, false: shape is radius
+ * @return false on any CUDA error (outputs are then unspecified)
+ */
+bool runBatch(Context *context, bool curvature, const double *x, const double *y, const double *theta,
+              const double *dlead, const double *shape, std::size_t count, double *outX, double *outY);
+
+}  // namespace cuda_offload
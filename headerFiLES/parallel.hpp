@@ -0,0 +1,266 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "simd.hpp"
+
+// ============================================
+// Parallel Batch Engine
+// ============================================
+// Splits a batch into fixed-size chunks and runs them on a persistent
+// work-stealing thread pool. Every chunk writes a disjoint slice of the
+// output with the same kernel the serial path uses, so the result does
+// not depend on the thread count or on which worker ran which chunk.
+
+// Poses per chunk. One pose touches 7 doubles (5 in, 2 out), so 4096
+// poses is ~224 KB of traffic and stays resident in a typical L2.
+const std::size_t PARALLEL_CHUNK_SIZE = 4096;
+
+// Chunks are rounded to this many poses so SIMD blocks line up with the
+// serial path (widest kernel is AVX-512, 8 doubles).
+const std::size_t PARALLEL_CHUNK_ALIGN = 8;
+
+/**
+ * @brief Fixed-size thread pool with per-worker deques and work stealing
+ *
+ * parallelFor() deals the chunk indices out to the workers in contiguous
+ * runs. A worker pops from the back of its own deque and, once empty,
+ * steals from the front of the others. The calling thread takes part as
+ * worker 0, so a pool of N threads spawns N - 1 helpers.
+ */
+class WorkStealingPool {
+public:
+    /**
+     * @param threadCount  Number of workers including the caller
+     *                     (0 = std::thread::hardware_concurrency())
+     */
+    explicit WorkStealingPool(unsigned threadCount = 0)
+        : queues_(resolveThreadCount(threadCount)) {
+        for (unsigned i = 1; i < queues_.size(); ++i) {
+            helpers_.emplace_back([this, i] { helperLoop(i); });
+        }
+    }
+
+    ~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(stateMutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread &t : helpers_) {
+            t.join();
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+    unsigned threadCount() const {
+        return static_cast<unsigned>(queues_.size());
+    }
+
+    /**
+     * @brief Runs task(chunk) for every chunk in [0, chunkCount) and waits
+     *
+     * Calls must not overlap (one parallelFor at a time per pool).
+     */
+    void parallelFor(std::size_t chunkCount, const std::function<void(std::size_t)> &task) {
+        if (chunkCount == 0) {
+            return;
+        }
+
+        std::size_t workers = queues_.size();
+        for (std::size_t w = 0; w < workers; ++w) {
+            std::size_t begin = chunkCount * w / workers;
+            std::size_t end = chunkCount * (w + 1) / workers;
+            std::lock_guard<std::mutex> lock(queues_[w].mutex);
+            for (std::size_t c = begin; c < end; ++c) {
+                queues_[w].chunks.push_back(c);
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(stateMutex_);
+            task_ = &task;
+            remaining_.store(chunkCount, std::memory_order_relaxed);
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        drain(0, task);
+
+        // Wait for the last chunk and for every helper to leave drain(), so
+        // no helper can still hold this task when the next call starts
+        std::unique_lock<std::mutex> lock(stateMutex_);
+        done_.wait(lock, [this] {
+            return remaining_.load(std::memory_order_acquire) == 0 && activeHelpers_ == 0;
+        });
+        task_ = nullptr;
+    }
+
+private:
+    struct alignas(64) WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::size_t> chunks;
+    };
+
+    static unsigned resolveThreadCount(unsigned requested) {
+        if (requested != 0) {
+            return requested;
+        }
+        unsigned hw = std::thread::hardware_concurrency();
+        return hw == 0 ? 1 : hw;
+    }
+
+    bool popOwn(std::size_t self, std::size_t &chunk) {
+        std::lock_guard<std::mutex> lock(queues_[self].mutex);
+        if (queues_[self].chunks.empty()) {
+            return false;
+        }
+        chunk = queues_[self].chunks.back();
+        queues_[self].chunks.pop_back();
+        return true;
+    }
+
+    bool steal(std::size_t self, std::size_t &chunk) {
+        std::size_t workers = queues_.size();
+        for (std::size_t offset = 1; offset < workers; ++offset) {
+            WorkerQueue &victim = queues_[(self + offset) % workers];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.chunks.empty()) {
+                chunk = victim.chunks.front();
+                victim.chunks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void drain(std::size_t self, const std::function<void(std::size_t)> &task) {
+        std::size_t chunk;
+        while (popOwn(self, chunk) || steal(self, chunk)) {
+            task(chunk);
+            if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> lock(stateMutex_);
+                done_.notify_all();
+            }
+        }
+    }
+
+    void helperLoop(std::size_t self) {
+        std::size_t seen = 0;
+        for (;;) {
+            const std::function<void(std::size_t)> *task;
+            {
+                std::unique_lock<std::mutex> lock(stateMutex_);
+                wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+                if (stopping_) {
+                    return;
+                }
+                seen = generation_;
+                task = task_;
+                if (task == nullptr) {
+                    continue;  // Woke after that call already finished
+                }
+                ++activeHelpers_;
+            }
+            drain(self, *task);
+            {
+                std::lock_guard<std::mutex> lock(stateMutex_);
+                --activeHelpers_;
+            }
+            done_.notify_all();
+        }
+    }
+
+    std::vector<WorkerQueue> queues_;
+    std::vector<std::thread> helpers_;
+    std::mutex stateMutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void(std::size_t)> *task_ = nullptr;
+    std::atomic<std::size_t> remaining_{0};
+    std::size_t generation_ = 0;
+    std::size_t activeHelpers_ = 0;
+    bool stopping_ = false;
+};
+
+namespace parallel_detail {
+
+inline std::size_t alignedChunkSize(std::size_t chunkSize) {
+    if (chunkSize < PARALLEL_CHUNK_ALIGN) {
+        return PARALLEL_CHUNK_ALIGN;
+    }
+    return (chunkSize + PARALLEL_CHUNK_ALIGN - 1) / PARALLEL_CHUNK_ALIGN * PARALLEL_CHUNK_ALIGN;
+}
+
+}  // namespace parallel_detail
+
+// ============================================
+// Parallel Batch Drivers
+// ============================================
+/**
+ * @brief Multithreaded calculateColinearPointBatchSimd()
+ *
+ * Output is bit-identical to a single calculateColinearPointBatchSimd()
+ * call over the whole array, for any pool size and chunk size.
+ *
+ * @param pool       Thread pool to run on
+ * @param chunkSize  Poses per work item (rounded up to PARALLEL_CHUNK_ALIGN)
+ */
+inline void parallelColinearPointBatch(
+    WorkStealingPool &pool,
+    const double *x,
+    const double *y,
+    const double *theta,
+    const double *dlead,
+    const double *radius,
+    std::size_t count,
+    double *outX,
+    double *outY,
+    std::size_t chunkSize = PARALLEL_CHUNK_SIZE
+) {
+    std::size_t chunk = parallel_detail::alignedChunkSize(chunkSize);
+    std::size_t chunkCount = (count + chunk - 1) / chunk;
+    pool.parallelFor(chunkCount, [&](std::size_t c) {
+        std::size_t begin = c * chunk;
+        std::size_t n = count - begin < chunk ? count - begin : chunk;
+        calculateColinearPointBatchSimd(x + begin, y + begin, theta + begin, dlead + begin,
+                                        radius + begin, n, outX + begin, outY + begin);
+    });
+}
+
+/**
+ * @brief Multithreaded calculateColinearPointWithCurvatureBatchSimd()
+ *
+ * Output is bit-identical to the serial SIMD call over the whole array.
+ *
+ * @param pool       Thread pool to run on
+ * @param chunkSize  Poses per work item (rounded up to PARALLEL_CHUNK_ALIGN)
+ */
+inline void parallelColinearPointWithCurvatureBatch(
+    WorkStealingPool &pool,
+    const double *x,
+    const double *y,
+    const double *theta,
+    const double *dlead,
+    const double *curvature,
+    std::size_t count,
+    double *outX,
+    double *outY,
+    std::size_t chunkSize = PARALLEL_CHUNK_SIZE
+) {
+    std::size_t chunk = parallel_detail::alignedChunkSize(chunkSize);
+    std::size_t chunkCount = (count + chunk - 1) / chunk;
+    pool.parallelFor(chunkCount, [&](std::size_t c) {
+        std::size_t begin = c * chunk;
+        std::size_t n = count - begin < chunk ? count - begin : chunk;
+        calculateColinearPointWithCurvatureBatchSimd(x + begin, y + begin, theta + begin, dlead + begin,
+                                                     curvature + begin, n, outX + begin, outY + begin);
+    });
+}
@@ -0,0 +1,263 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "clothoid.hpp"
+#include "geometry.hpp"
+
+// ============================================
+// Multi-Segment Path
+// ============================================
+// A route of lines, arcs and clothoids chained end to end, stored as
+// structure of arrays (start pose, start curvature, curvature rate,
+// length) with a prefix sum of the segment lengths. A query for the
+// point at global arc length s binary-searches the prefix sums, O(log n),
+// and evaluates that one segment. Batches of non-decreasing s, and
+// PathCursor for a lookahead that advances tick by tick, walk forward
+// from the previous segment instead, O(1) amortized.
+//
+// Every segment, including lines (curvature 0) and arcs (rate 0), is
+// evaluated with calculateClothoidPoint(), so negative curvature turns
+// right and each segment starts exactly at the end pose computed for its
+// predecessor when it was appended.
+//
+// Queries outside [0, length()] are clamped to the ends of the path.
+
+/**
+ * @brief Contiguous chain of constant- and linear-curvature segments
+ */
+class SegmentPath {
+public:
+    /**
+     * @param x      Start x of the first segment
+     * @param y      Start y of the first segment
+     * @param theta  Start heading in radians
+     */
+    explicit SegmentPath(double x = 0.0, double y = 0.0, double theta = 0.0) {
+        reset(x, y, theta);
+    }
+
+    /**
+     * @brief Drops all segments and sets a new start pose (capacity is kept)
+     */
+    void reset(double x, double y, double theta) {
+        startX_.clear();
+        startY_.clear();
+        startTheta_.clear();
+        startSin_.clear();
+        startCos_.clear();
+        curvature_.clear();
+        curvatureRate_.clear();
+        length_.clear();
+        prefix_.assign(1, 0.0);
+        endX_ = x;
+        endY_ = y;
+        endTheta_ = theta;
+    }
+
+    void reserve(std::size_t segments) {
+        for (std::vector<double> *column : {&startX_, &startY_, &startTheta_, &startSin_, &startCos_, &curvature_,
+                                            &curvatureRate_, &length_}) {
+            column->reserve(segments);
+        }
+        prefix_.reserve(segments + 1);
+    }
+
+    /**
+     * @brief Appends a straight segment at the end of the path
+     * @return false (nothing appended) if length is not positive and finite
+     */
+    bool appendLine(double length) {
+        return appendClothoid(0.0, 0.0, length);
+    }
+
+    /**
+     * @brief Appends an arc of constant curvature (positive = left, 0 = line)
+     */
+    bool appendArc(double curvature, double length) {
+        return appendClothoid(curvature, curvature, length);
+    }
+
+    /**
+     * @brief Appends a clothoid whose curvature goes linearly from startCurvature to endCurvature
+     */
+    bool appendClothoid(double startCurvature, double endCurvature, double length) {
+        if (!(length >= MIN_DLEAD) || !(length <= MAX_DLEAD)) {
+            return false;
+        }
+        ClothoidSegment segment = makeClothoidTransition(startCurvature, endCurvature, length);
+        PoseContext start = makePoseContext(endX_, endY_, endTheta_);
+        startX_.push_back(start.x);
+        startY_.push_back(start.y);
+        startTheta_.push_back(endTheta_);
+        startSin_.push_back(start.sinTheta);
+        startCos_.push_back(start.cosTheta);
+        curvature_.push_back(segment.startCurvature);
+        curvatureRate_.push_back(segment.curvatureRate);
+        length_.push_back(length);
+        prefix_.push_back(prefix_.back() + length);
+
+        Point end = calculateClothoidPoint(start, length, segment);
+        endX_ = end.x;
+        endY_ = end.y;
+        endTheta_ = clothoidHeading(endTheta_, length, segment);
+        return true;
+    }
+
+    std::size_t segmentCount() const {
+        return length_.size();
+    }
+
+    /**
+     * @brief Total arc length
+     */
+    double length() const {
+        return prefix_.back();
+    }
+
+    /**
+     * @brief Arc length at the start of segment i (i == segmentCount() gives length())
+     */
+    double segmentStart(std::size_t i) const {
+        return prefix_[i];
+    }
+
+    /**
+     * @brief Segment containing global arc length s, by binary search
+     *
+     * Boundaries belong to the following segment; s outside the path maps
+     * to the first or last segment. Needs at least one segment.
+     */
+    std::size_t findSegment(double s) const {
+        // Interior boundaries are prefix_[1 .. n - 1]
+        std::vector<double>::const_iterator first = prefix_.begin() + 1;
+        std::vector<double>::const_iterator last = prefix_.end() - 1;
+        return static_cast<std::size_t>(std::upper_bound(first, last, s) - first);
+    }
+
+    /**
+     * @brief Point at global arc length s (O(log n))
+     */
+    Point pointAt(double s) const {
+        if (length_.empty()) {
+            return Point{endX_, endY_};
+        }
+        return pointOnSegment(findSegment(s), s);
+    }
+
+    /**
+     * @brief Heading at global arc length s (radians, not wrapped)
+     */
+    double headingAt(double s) const {
+        if (length_.empty()) {
+            return endTheta_;
+        }
+        std::size_t i = findSegment(s);
+        double local = clampLocal(i, s);
+        return startTheta_[i] + curvature_[i] * local + 0.5 * curvatureRate_[i] * local * local;
+    }
+
+    /**
+     * @brief Points at many global arc lengths
+     *
+     * Each query starts from the segment of the previous one and walks
+     * forward, so non-decreasing s costs O(1) amortized per point. A
+     * query that goes backwards falls back to findSegment().
+     */
+    void pointsAtBatch(const double *s, std::size_t count, Point *out) const {
+        if (length_.empty()) {
+            for (std::size_t k = 0; k < count; ++k) {
+                out[k] = Point{endX_, endY_};
+            }
+            return;
+        }
+        std::size_t i = findSegment(count > 0 ? s[0] : 0.0);
+        for (std::size_t k = 0; k < count; ++k) {
+            i = advanceSegment(i, s[k]);
+            out[k] = pointOnSegment(i, s[k]);
+        }
+    }
+
+    /**
+     * @brief Segment for s, walking forward from segment i (or searching if s is behind it)
+     */
+    std::size_t advanceSegment(std::size_t i, double s) const {
+        if (s < prefix_[i]) {
+            return findSegment(s);
+        }
+        std::size_t last = length_.size() - 1;
+        while (i < last && s >= prefix_[i + 1]) {
+            ++i;
+        }
+        return i;
+    }
+
+    /**
+     * @brief Point on segment i at global arc length s (clamped to the segment)
+     */
+    Point pointOnSegment(std::size_t i, double s) const {
+        PoseContext start;
+        start.x = startX_[i];
+        start.y = startY_[i];
+        start.sinTheta = startSin_[i];
+        start.cosTheta = startCos_[i];
+        ClothoidSegment segment;
+        segment.startCurvature = curvature_[i];
+        segment.curvatureRate = curvatureRate_[i];
+        return calculateClothoidPoint(start, clampLocal(i, s), segment);
+    }
+
+private:
+    double clampLocal(std::size_t i, double s) const {
+        double local = s - prefix_[i];
+        local = local < 0.0 && i == 0 ? 0.0 : local;
+        double last = length_[i];
+        return local > last && i + 1 == length_.size() ? last : local;
+    }
+
+    // One entry per segment
+    std::vector<double> startX_;
+    std::vector<double> startY_;
+    std::vector<double> startTheta_;
+    std::vector<double> startSin_;
+    std::vector<double> startCos_;
+    std::vector<double> curvature_;      // Curvature at the segment start
+    std::vector<double> curvatureRate_;  // d curvature / ds
+    std::vector<double> length_;
+    std::vector<double> prefix_;         // prefix_[i] = arc length before segment i, n + 1 entries
+
+    // Pose at the end of the last segment (the start pose if empty)
+    double endX_ = 0.0;
+    double endY_ = 0.0;
+    double endTheta_ = 0.0;
+};
+
+/**
+ * @brief Remembers the current segment of a lookahead that mostly moves forward
+ *
+ *   PathCursor cursor(path);
+ *   ...
+ *   Point carrot = cursor.pointAt(progress + dlead);   // every tick
+ *
+ * The path must outlive the cursor and not be modified while it is used.
+ */
+class PathCursor {
+public:
+    explicit PathCursor(const SegmentPath &path) : path_(path) {}
+
+    Point pointAt(double s) {
+        if (path_.segmentCount() == 0) {
+            return path_.pointAt(s);
+        }
+        segment_ = path_.advanceSegment(segment_ < path_.segmentCount() ? segment_ : 0, s);
+        return path_.pointOnSegment(segment_, s);
+    }
+
+    std::size_t segment() const {
+        return segment_;
+    }
+
+private:
+    const SegmentPath &path_;
+    std::size_t segment_ = 0;
+};
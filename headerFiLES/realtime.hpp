@@ -0,0 +1,180 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "angles.hpp"
+#include "geometry.hpp"
+#include "simd.hpp"
+
+#if defined(COLINEAR_REALTIME) && defined(COLINEAR_INSTRUMENT)
+    #error "COLINEAR_INSTRUMENT allocates thread-local counters and takes a lock; disable it for real-time builds"
+#endif
+
+// ============================================
+// Real-Time Curve Entry Points
+// ============================================
+// Versions of the curve functions for hard real-time threads:
+//
+// - noexcept, no heap, no locks, no libm, no iostream or locale;
+// - one fixed instruction path: the MIN_DLEAD / MAX_DLEAD / radius /
+//   EPSILON / straight-line rules are evaluated as bit-mask selects and
+//   every call runs the full arc, so the cost does not depend on the
+//   input (NaN and infinities included);
+// - sin/cos is the polynomial of the SIMD kernels (simd_detail) in scalar
+//   form, with a branch-free quadrant fix-up instead of libm's
+//   size-dependent argument reduction.
+//
+// Accuracy is that of the SIMD kernels: within 2 ULP of libm sin/cos for
+// |angle| <= SIMD_TRIG_MAX_ARG and a few ULP on the output point. Larger
+// arc angles, up to the reachable MAX_DLEAD / EPSILON = 1e15, take the
+// same time but lose precision in the reduction (libm would recompute
+// them exactly, which is the data-dependent cost this path avoids).
+// Headings that can grow without bound should go through wrapAngle()
+// first, which is branch-free as well. Subnormal operands still take
+// microcode assists on x86, so real-time threads should run with FTZ/DAZ
+// set (see wcet_harness --ftz).
+//
+// The colinear_realtime CMake target builds consumers with exceptions and
+// RTTI off and defines COLINEAR_REALTIME, which rejects instrumented
+// builds. The interactive screens live in the separate colinear_ui
+// library, so nothing here links <iostream> or system().
+
+namespace rt_detail {
+
+/**
+ * @brief condition ? a : b through bit masks (never a branch)
+ */
+inline double select(bool condition, double a, double b) noexcept {
+    std::uint64_t mask = 0 - static_cast<std::uint64_t>(condition);
+    std::uint64_t bitsA;
+    std::uint64_t bitsB;
+    std::memcpy(&bitsA, &a, sizeof(double));
+    std::memcpy(&bitsB, &b, sizeof(double));
+    std::uint64_t bits = (bitsA & mask) | (bitsB & ~mask);
+    double result;
+    std::memcpy(&result, &bits, sizeof(double));
+    return result;
+}
+
+/**
+ * @brief Fixed-path polynomial sincos
+ *
+ * The quadrant is rounded with the 1.5 * 2^52 shift and read from the low
+ * mantissa bits of the shifted value, which avoids a float-to-int
+ * conversion (undefined for NaN). The shift goes through
+ * angle_detail::shiftedForRounding() so that fast-math builds cannot fold
+ * k back to the unrounded angle * 2 / pi.
+ */
+inline void sinCos(double angle, double &sinOut, double &cosOut) noexcept {
+    using namespace simd_detail;
+    double shifted = angle_detail::shiftedForRounding(angle * TWO_OVER_PI);
+    double k = shifted - angle_detail::ROUNDING_SHIFT;
+    std::uint64_t bits;
+    std::memcpy(&bits, &shifted, sizeof(double));
+    unsigned quadrant = static_cast<unsigned>(bits & 3);
+
+    double r = ((angle - k * PIO2_1) - k * PIO2_2) - k * PIO2_3;
+    double z = r * r;
+    double ps = S2 + z * (S3 + z * (S4 + z * (S5 + z * S6)));
+    double sr = r + r * z * (S1 + z * ps);
+    double pc = C1 + z * (C2 + z * (C3 + z * (C4 + z * (C5 + z * C6))));
+    double cr = 1.0 - 0.5 * z + z * z * pc;
+
+    bool swap = (quadrant & 1) != 0;
+    double s = select(swap, cr, sr);
+    double c = select(swap, sr, cr);
+    sinOut = select((quadrant & 2) != 0, -s, s);
+    cosOut = select(((quadrant + 1) & 2) != 0, -c, c);
+}
+
+}  // namespace rt_detail
+
+/**
+ * @brief makePoseContext() on the fixed-path sincos
+ */
+inline PoseContext rtMakePoseContext(double x, double y, double theta) noexcept {
+    PoseContext pose;
+    pose.x = x;
+    pose.y = y;
+    rt_detail::sinCos(theta, pose.sinTheta, pose.cosTheta);
+    return pose;
+}
+
+/**
+ * @brief Fixed-path calculateColinearPoint() from a pose context
+ * @param pose    Pose with cached heading rotation
+ * @param dlead   Lookahead distance along the curve
+ * @param radius  Curvature radius (same fallback rules as calculateColinearPoint())
+ */
+inline Point rtColinearPoint(const PoseContext &pose, double dlead, double radius) noexcept {
+    using rt_detail::select;
+    bool stay = std::abs(dlead) < MIN_DLEAD;
+    double d = select(dlead > MAX_DLEAD, MAX_DLEAD, dlead);
+    d = select(d < -MAX_DLEAD, -MAX_DLEAD, d);
+    double r = select(std::abs(radius) < EPSILON, DEFAULT_CURVATURE_RADIUS, std::abs(radius));
+
+    double sinPhi;
+    double cosPhi;
+    rt_detail::sinCos(d / r, sinPhi, cosPhi);
+    double localX = r * sinPhi;
+    double localY = r * (1.0 - cosPhi);
+    double rx = pose.x + localX * pose.cosTheta - localY * pose.sinTheta;
+    double ry = pose.y + localX * pose.sinTheta + localY * pose.cosTheta;
+    rx = select(std::abs(rx) < EPSILON, 0.0, rx);
+    ry = select(std::abs(ry) < EPSILON, 0.0, ry);
+
+    Point result;
+    result.x = select(stay, pose.x, rx);
+    result.y = select(stay, pose.y, ry);
+    return result;
+}
+
+/**
+ * @brief Fixed-path calculateColinearPoint()
+ */
+inline Point rtColinearPoint(double x, double y, double theta, double dlead,
+                             double radius = DEFAULT_CURVATURE_RADIUS) noexcept {
+    return rtColinearPoint(rtMakePoseContext(x, y, theta), dlead, radius);
+}
+
+/**
+ * @brief Fixed-path calculateColinearPointWithCurvature()
+ *
+ * Both the arc and the straight line are evaluated and the result is
+ * selected, so zero curvature costs the same as any other value.
+ */
+inline Point rtColinearPointWithCurvature(double x, double y, double theta, double dlead,
+                                          double curvature) noexcept {
+    using rt_detail::select;
+    PoseContext pose = rtMakePoseContext(x, y, theta);
+    bool line = std::abs(curvature) < EPSILON;
+    // 1 / 0 in a straight-line lane is discarded by the select below
+    double radius = select(line, DEFAULT_CURVATURE_RADIUS, 1.0 / std::abs(curvature));
+    Point arc = rtColinearPoint(pose, select(curvature < 0.0, -dlead, dlead), radius);
+
+    Point result;
+    result.x = select(line, x + dlead * pose.cosTheta, arc.x);
+    result.y = select(line, y + dlead * pose.sinTheta, arc.y);
+    return result;
+}
+
+/**
+ * @brief Fixed-path calculateColinearPointBatch(): count identical iterations
+ */
+inline void rtColinearPointBatch(
+    const double *x,
+    const double *y,
+    const double *theta,
+    const double *dlead,
+    const double *radius,
+    std::size_t count,
+    double *outX,
+    double *outY
+) noexcept {
+    for (std::size_t i = 0; i < count; ++i) {
+        Point p = rtColinearPoint(x[i], y[i], theta[i], dlead[i], radius[i]);
+        outX[i] = p.x;
+        outY[i] = p.y;
+    }
+}
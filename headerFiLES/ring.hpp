@@ -0,0 +1,481 @@
+#pragma once
+#include <atomic>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include "geometry.hpp"
+#include "stream.hpp"
+
+#if defined(_WIN32)
+    #define COLINEAR_HAVE_SHM 0
+#else
+    #define COLINEAR_HAVE_SHM 1
+    #include <fcntl.h>
+    #include <signal.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #include <immintrin.h>
+#endif
+
+// ============================================
+// Shared-Memory Pose Ring
+// ============================================
+// Two single-producer/single-consumer rings in one POSIX shared-memory
+// segment: poses go from the odometry process to the calculator, points
+// come back. Each ring is a power-of-two array of slots with a head index
+// (written only by the producer) and a tail index (written only by the
+// consumer), each on its own cache line, so the two sides never write the
+// same line except for the slot being handed over. Each side also keeps
+// a private copy of the other side's index and rereads the shared one
+// only when the ring looks full (producer) or empty (consumer), so a
+// steady stream costs one shared-line transfer per slot, not per check.
+//
+// Handoff is a release store of the index after the slot is written and
+// an acquire load before the slot is read; no syscalls or locks, so the
+// round trip is a few cache-line transfers. Waiting sides busy-poll and
+// only yield the CPU after RING_SPIN_LIMIT empty polls, so on a dedicated
+// core the handoff never enters the kernel, while a calculator sharing a
+// core with its producer does not starve it for a whole time slice.
+//
+// Slots carry the caller's sequence number, which comes back with the
+// point, so a producer that submits several poses per tick can match the
+// answers up.
+
+const std::size_t RING_CACHE_LINE = 64;
+
+// Slots per ring (power of two). 1024 poses is a second of 1 kHz odometry.
+const std::size_t RING_CAPACITY = 1024;
+
+// Empty polls before a waiting side calls std::this_thread::yield()
+const unsigned RING_SPIN_LIMIT = 4096;
+
+const char RING_MAGIC[4] = {'C', 'P', 'C', 'R'};
+const std::uint32_t RING_VERSION = 1;
+
+static_assert((RING_CAPACITY & (RING_CAPACITY - 1)) == 0, "ring capacity must be a power of two");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "shared-memory rings need lock-free 64-bit atomics");
+
+/**
+ * @brief Pose handed to the calculator
+ */
+struct RingPose {
+    double x = 0.0;
+    double y = 0.0;
+    double theta = 0.0;                      // Heading in radians
+    double dlead = 0.0;
+    double radius = DEFAULT_CURVATURE_RADIUS;
+    std::uint64_t sequence = 0;              // Echoed in the RingPoint
+};
+
+/**
+ * @brief calculateColinearPoint() result for one RingPose
+ */
+struct RingPoint {
+    Point point;
+    std::uint64_t sequence = 0;
+};
+
+namespace ring_detail {
+
+/**
+ * @brief Spin-wait hint (PAUSE on x86, YIELD on ARM)
+ */
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/**
+ * @brief Spin, then yield, while waiting on the other side of a ring
+ */
+class SpinWait {
+public:
+    void idle() {
+        if (++spins_ < RING_SPIN_LIMIT) {
+            cpuRelax();
+        } else {
+            spins_ = 0;
+            std::this_thread::yield();
+        }
+    }
+
+    void reset() {
+        spins_ = 0;
+    }
+
+private:
+    unsigned spins_ = 0;
+};
+
+}  // namespace ring_detail
+
+/**
+ * @brief Shared state of one SPSC ring; lives in the shared segment
+ *
+ * Indices count slots ever pushed / popped and never wrap in practice
+ * (2^64 slots); the slot of index i is i % Capacity.
+ */
+template <typename T, std::size_t Capacity = RING_CAPACITY>
+struct SpscRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "ring capacity must be a power of two");
+
+    alignas(RING_CACHE_LINE) std::atomic<std::uint64_t> head{0};  // Next slot to write (producer)
+    alignas(RING_CACHE_LINE) std::atomic<std::uint64_t> tail{0};  // Next slot to read (consumer)
+    alignas(RING_CACHE_LINE) T slots[Capacity];
+};
+
+/**
+ * @brief Producer end of an SpscRing (one per ring, private to its process)
+ */
+template <typename T, std::size_t Capacity = RING_CAPACITY>
+class SpscProducer {
+public:
+    explicit SpscProducer(SpscRing<T, Capacity> &ring)
+        : ring_(ring),
+          head_(ring.head.load(std::memory_order_relaxed)),
+          tailCache_(ring.tail.load(std::memory_order_acquire)) {}
+
+    /**
+     * @return false if the ring is full (nothing written)
+     */
+    bool tryPush(const T &value) {
+        if (head_ - tailCache_ == Capacity) {
+            tailCache_ = ring_.tail.load(std::memory_order_acquire);
+            if (head_ - tailCache_ == Capacity) {
+                return false;
+            }
+        }
+        ring_.slots[head_ & (Capacity - 1)] = value;
+        ++head_;
+        ring_.head.store(head_, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Spins until there is room
+     */
+    void push(const T &value) {
+        ring_detail::SpinWait wait;
+        while (!tryPush(value)) {
+            wait.idle();
+        }
+    }
+
+private:
+    SpscRing<T, Capacity> &ring_;
+    std::uint64_t head_;
+    std::uint64_t tailCache_;
+};
+
+/**
+ * @brief Consumer end of an SpscRing (one per ring, private to its process)
+ */
+template <typename T, std::size_t Capacity = RING_CAPACITY>
+class SpscConsumer {
+public:
+    explicit SpscConsumer(SpscRing<T, Capacity> &ring)
+        : ring_(ring),
+          tail_(ring.tail.load(std::memory_order_relaxed)),
+          headCache_(ring.head.load(std::memory_order_acquire)) {}
+
+    /**
+     * @return false if the ring is empty
+     */
+    bool tryPop(T &value) {
+        if (tail_ == headCache_) {
+            headCache_ = ring_.head.load(std::memory_order_acquire);
+            if (tail_ == headCache_) {
+                return false;
+            }
+        }
+        value = ring_.slots[tail_ & (Capacity - 1)];
+        ++tail_;
+        ring_.tail.store(tail_, std::memory_order_release);
+        return true;
+    }
+
+private:
+    SpscRing<T, Capacity> &ring_;
+    std::uint64_t tail_;
+    std::uint64_t headCache_;
+};
+
+/**
+ * @brief Layout of the shared segment
+ *
+ * ready is set (release) once the creator has constructed both rings;
+ * openers check it with the magic and version before touching them.
+ */
+struct ColinearRingSegment {
+    alignas(RING_CACHE_LINE) char magic[4];
+    std::uint32_t version;
+    std::uint64_t capacity;
+    std::atomic<std::uint32_t> ready;
+    SpscRing<RingPose> poses;    // odometry -> calculator
+    SpscRing<RingPoint> points;  // calculator -> odometry
+};
+
+// ============================================
+// Busy-Poll Calculator Loop
+// ============================================
+/**
+ * @brief Answers poses until stop is set
+ *
+ * Each pose runs through basicColinearPoint(), the inlined core of
+ * calculateColinearPoint() (same result, no instrumentation hooks). A
+ * full point ring stalls the loop rather than dropping answers.
+ *
+ * @return Number of poses answered
+ */
+inline std::uint64_t serveColinearRing(ColinearRingSegment &segment, const volatile std::sig_atomic_t &stop) {
+    SpscConsumer<RingPose> poses(segment.poses);
+    SpscProducer<RingPoint> points(segment.points);
+    std::uint64_t served = 0;
+    ring_detail::SpinWait wait;
+    RingPose pose;
+    while (!stop) {
+        if (!poses.tryPop(pose)) {
+            wait.idle();
+            continue;
+        }
+        wait.reset();
+        RingPoint answer;
+        answer.point = basicColinearPoint<double>(makePoseContext(pose.x, pose.y, pose.theta), pose.dlead, pose.radius);
+        answer.sequence = pose.sequence;
+        while (!points.tryPush(answer)) {
+            if (stop) {
+                return served;
+            }
+            wait.idle();
+        }
+        ++served;
+    }
+    return served;
+}
+
+#if COLINEAR_HAVE_SHM
+
+// ============================================
+// Shared Segment Mapping
+// ============================================
+/**
+ * @brief RAII mapping of a ColinearRingSegment (shm_open + mmap)
+ *
+ * The calculator create()s the segment and unlinks the name when it is
+ * destroyed; the odometry process open()s it. Names follow shm_open()
+ * rules ("/name").
+ */
+class SharedRingMapping {
+public:
+    SharedRingMapping() = default;
+    SharedRingMapping(const SharedRingMapping &) = delete;
+    SharedRingMapping &operator=(const SharedRingMapping &) = delete;
+
+    ~SharedRingMapping() {
+        close();
+    }
+
+    /**
+     * @brief Creates (or replaces) the segment, mode 0600, and constructs the rings
+     */
+    bool create(const std::string &name, std::string &error) {
+        close();
+        ::shm_unlink(name.c_str());
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            error = "cannot create shared memory '" + name + "'";
+            return false;
+        }
+        if (::ftruncate(fd, static_cast<off_t>(sizeof(ColinearRingSegment))) != 0) {
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            error = "cannot size shared memory '" + name + "'";
+            return false;
+        }
+        if (!map(fd)) {
+            ::shm_unlink(name.c_str());
+            error = "cannot map shared memory '" + name + "'";
+            return false;
+        }
+        segment_ = new (segment_) ColinearRingSegment();
+        std::memcpy(segment_->magic, RING_MAGIC, sizeof(segment_->magic));
+        segment_->version = RING_VERSION;
+        segment_->capacity = RING_CAPACITY;
+        segment_->ready.store(1, std::memory_order_release);
+        name_ = name;
+        owner_ = true;
+        return true;
+    }
+
+    /**
+     * @brief Maps a segment created by another process
+     */
+    bool open(const std::string &name, std::string &error) {
+        close();
+        int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            error = "cannot open shared memory '" + name + "'";
+            return false;
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(ColinearRingSegment)) {
+            ::close(fd);
+            error = "shared memory '" + name + "' is not a pose ring";
+            return false;
+        }
+        if (!map(fd)) {
+            error = "cannot map shared memory '" + name + "'";
+            return false;
+        }
+        if (segment_->ready.load(std::memory_order_acquire) != 1 ||
+            std::memcmp(segment_->magic, RING_MAGIC, sizeof(segment_->magic)) != 0 ||
+            segment_->version != RING_VERSION || segment_->capacity != RING_CAPACITY) {
+            close();
+            error = "shared memory '" + name + "' is not a compatible pose ring";
+            return false;
+        }
+        return true;
+    }
+
+    void close() {
+        if (segment_ != nullptr) {
+            ::munmap(segment_, sizeof(ColinearRingSegment));
+            segment_ = nullptr;
+        }
+        if (owner_) {
+            ::shm_unlink(name_.c_str());
+            owner_ = false;
+        }
+    }
+
+    ColinearRingSegment *segment() const {
+        return segment_;
+    }
+
+private:
+    // Maps and closes fd (the mapping keeps the segment alive)
+    bool map(int fd) {
+        void *p = ::mmap(nullptr, sizeof(ColinearRingSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) {
+            return false;
+        }
+        segment_ = static_cast<ColinearRingSegment *>(p);
+        return true;
+    }
+
+    ColinearRingSegment *segment_ = nullptr;
+    std::string name_;
+    bool owner_ = false;
+};
+
+/**
+ * @brief Odometry side of a pose ring
+ *
+ * One instance per process: it is the only producer of poses and the
+ * only consumer of points.
+ */
+class ColinearRingClient {
+public:
+    bool open(const std::string &name, std::string &error) {
+        producer_ = nullptr;
+        consumer_ = nullptr;
+        if (!mapping_.open(name, error)) {
+            return false;
+        }
+        ColinearRingSegment &segment = *mapping_.segment();
+        producer_.reset(new SpscProducer<RingPose>(segment.poses));
+        consumer_.reset(new SpscConsumer<RingPoint>(segment.points));
+        return true;
+    }
+
+    bool trySubmit(const RingPose &pose) {
+        return producer_->tryPush(pose);
+    }
+
+    bool tryReceive(RingPoint &point) {
+        return consumer_->tryPop(point);
+    }
+
+    /**
+     * @brief Submits one pose and spins for its point
+     *
+     * Only for callers with no other poses in flight.
+     */
+    Point calculate(double x, double y, double theta, double dlead, double radius = DEFAULT_CURVATURE_RADIUS) {
+        RingPose pose;
+        pose.x = x;
+        pose.y = y;
+        pose.theta = theta;
+        pose.dlead = dlead;
+        pose.radius = radius;
+        pose.sequence = nextSequence_++;
+        producer_->push(pose);
+        RingPoint answer;
+        ring_detail::SpinWait wait;
+        while (!consumer_->tryPop(answer)) {
+            wait.idle();
+        }
+        return answer.point;
+    }
+
+private:
+    SharedRingMapping mapping_;
+    std::unique_ptr<SpscProducer<RingPose>> producer_;
+    std::unique_ptr<SpscConsumer<RingPoint>> consumer_;
+    std::uint64_t nextSequence_ = 0;
+};
+
+namespace ring_detail {
+
+inline volatile std::sig_atomic_t &stopRequested() {
+    static volatile std::sig_atomic_t flag = 0;
+    return flag;
+}
+
+extern "C" inline void handleRingStopSignal(int) {
+    stopRequested() = 1;
+}
+
+}  // namespace ring_detail
+
+#endif  // COLINEAR_HAVE_SHM
+
+/**
+ * @brief --ring entry point: creates the segment and busy-polls it until SIGINT or SIGTERM
+ * @return 0 after a clean shutdown, 1 if the segment could not be created
+ */
+inline int runRing(const StreamOptions &options) {
+#if COLINEAR_HAVE_SHM
+    SharedRingMapping mapping;
+    std::string error;
+    if (!mapping.create(options.ringName, error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    std::signal(SIGINT, ring_detail::handleRingStopSignal);
+    std::signal(SIGTERM, ring_detail::handleRingStopSignal);
+    std::fprintf(stderr, "polling pose ring %s\n", options.ringName.c_str());
+    std::uint64_t served = serveColinearRing(*mapping.segment(), ring_detail::stopRequested());
+    std::fprintf(stderr, "poses answered %llu\n", static_cast<unsigned long long>(served));
+    return 0;
+#else
+    (void)options;
+    std::fprintf(stderr, "error: --ring needs POSIX shared memory, which this platform lacks\n");
+    return 1;
+#endif
+}
@@ -0,0 +1,871 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "binaryio.hpp"
+#include "cache.hpp"
+#include "controller.hpp"
+#include "parallel.hpp"
+#include "stream.hpp"
+
+#if defined(_WIN32)
+    #define COLINEAR_HAVE_UNIX_SOCKETS 0
+#else
+    #define COLINEAR_HAVE_UNIX_SOCKETS 1
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <sys/socket.h>
+    #include <sys/stat.h>
+    #include <sys/uio.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+// ============================================
+// Server Request Protocol
+// ============================================
+// Every message is a 16-byte little-endian frame header followed by
+// packed float64 columns, like the binary pose files:
+//
+//   offset  size  field
+//   0       4     magic "CPCQ" (request) / "CPCA" (response)
+//   4       2     version (1)
+//   6       1     request: kind (ServerRequestKind)
+//                 response: status (ServerStatus)
+//   7       1     request: flags (SERVER_FLAG_*), response: kind echoed
+//   8       4     count (rows)
+//   12      4     request id, echoed in the response
+//   16            columns [count] each
+//
+// Requests carry five columns (x, y, theta, dlead, param); param is the
+// radius for Arc and Boomerang and the curvature for Curvature. Responses
+// carry two columns (x, y), or four for Boomerang (carrot x, carrot y,
+// chord bearing, chord length). A Stats request has no columns and is
+// answered with a ServerStats record. Frames are multiples of 8 bytes, so
+// columns stay 8-byte aligned in the receive buffer and the batch kernels
+// run on it in place.
+//
+// A connection may pipeline any number of requests; responses come back
+// in request order.
+
+const char SERVER_REQUEST_MAGIC[4] = {'C', 'P', 'C', 'Q'};
+const char SERVER_RESPONSE_MAGIC[4] = {'C', 'P', 'C', 'A'};
+const std::uint16_t SERVER_PROTOCOL_VERSION = 1;
+
+// Largest batch one frame may carry (56 MB of request and response columns)
+const std::uint32_t SERVER_MAX_BATCH = 1 << 20;
+
+// Batches of at least this many rows are split across the thread pool
+const std::size_t SERVER_PARALLEL_THRESHOLD = 1 << 15;
+
+// Latency samples kept for the percentiles (the most recent requests)
+const std::size_t SERVER_LATENCY_WINDOW = 1 << 16;
+
+enum class ServerRequestKind : std::uint8_t {
+    Arc = 0,
+    Curvature = 1,
+    Boomerang = 2,
+    Stats = 3
+};
+
+enum class ServerStatus : std::uint8_t {
+    Ok = 0,
+    BadRequest = 1,
+    TooLarge = 2
+};
+
+// Request flags
+const std::uint8_t SERVER_FLAG_FAST = 1;    // SIMD kernels (Arc and Curvature)
+const std::uint8_t SERVER_FLAG_CACHED = 2;  // through the server's ColinearPointCache (Arc and Curvature)
+
+struct ServerFrameHeader {
+    char magic[4];
+    std::uint16_t version;
+    std::uint8_t kindOrStatus;
+    std::uint8_t flagsOrKind;
+    std::uint32_t count;
+    std::uint32_t requestId;
+};
+static_assert(sizeof(ServerFrameHeader) == 16, "server frame header must be 16 bytes");
+
+/**
+ * @brief Service counters, the payload of a Stats response
+ *
+ * Latencies run from a request frame being fully received to its
+ * response being handed to the kernel, over the last
+ * SERVER_LATENCY_WINDOW requests.
+ */
+struct ServerStats {
+    std::uint64_t requests = 0;   // Batch requests served (Stats requests excluded)
+    std::uint64_t points = 0;     // Rows evaluated
+    std::uint64_t rejected = 0;   // Malformed or oversized requests
+    std::uint64_t clients = 0;    // Connections accepted
+    std::uint64_t p50Ns = 0;
+    std::uint64_t p99Ns = 0;
+    std::uint64_t maxNs = 0;      // Over the window
+    std::uint64_t reserved = 0;
+};
+static_assert(sizeof(ServerStats) == 64, "server stats record must be 64 bytes");
+
+inline std::size_t serverOutputColumns(ServerRequestKind kind) {
+    return kind == ServerRequestKind::Boomerang ? 4 : 2;
+}
+
+inline ServerFrameHeader makeServerRequestHeader(ServerRequestKind kind, std::uint8_t flags,
+                                                 std::uint32_t count, std::uint32_t requestId) {
+    ServerFrameHeader header;
+    std::memcpy(header.magic, SERVER_REQUEST_MAGIC, sizeof(header.magic));
+    header.version = SERVER_PROTOCOL_VERSION;
+    header.kindOrStatus = static_cast<std::uint8_t>(kind);
+    header.flagsOrKind = flags;
+    header.count = count;
+    header.requestId = requestId;
+    return header;
+}
+
+// ============================================
+// Latency Window
+// ============================================
+/**
+ * @brief Ring of the most recent latency samples with percentile queries
+ */
+class LatencyWindow {
+public:
+    explicit LatencyWindow(std::size_t capacity = SERVER_LATENCY_WINDOW)
+        : samples_(capacity == 0 ? 1 : capacity) {}
+
+    void record(std::uint64_t nanoseconds) {
+        samples_[next_] = nanoseconds;
+        next_ = next_ + 1 == samples_.size() ? 0 : next_ + 1;
+        if (size_ < samples_.size()) {
+            ++size_;
+        }
+    }
+
+    std::size_t size() const {
+        return size_;
+    }
+
+    /**
+     * @brief Sample at quantile q in [0, 1] (nearest rank), 0 if empty
+     */
+    std::uint64_t percentile(double q) const {
+        if (size_ == 0) {
+            return 0;
+        }
+        scratch_.assign(samples_.begin(), samples_.begin() + static_cast<std::ptrdiff_t>(size_));
+        std::size_t rank = static_cast<std::size_t>(q * static_cast<double>(size_ - 1) + 0.5);
+        rank = rank >= size_ ? size_ - 1 : rank;
+        std::nth_element(scratch_.begin(), scratch_.begin() + static_cast<std::ptrdiff_t>(rank), scratch_.end());
+        return scratch_[rank];
+    }
+
+    std::uint64_t maximum() const {
+        return size_ == 0 ? 0 : *std::max_element(samples_.begin(), samples_.begin() + static_cast<std::ptrdiff_t>(size_));
+    }
+
+private:
+    std::vector<std::uint64_t> samples_;
+    mutable std::vector<std::uint64_t> scratch_;
+    std::size_t next_ = 0;
+    std::size_t size_ = 0;
+};
+
+// ============================================
+// Request Engine
+// ============================================
+/**
+ * @brief Evaluates request frames; shared by every client of a server
+ *
+ * Owns nothing per connection: the thread pool and the point cache live
+ * as long as the engine, so successive clients hit a warm cache and never
+ * pay for thread start-up. Not thread-safe; one engine per event loop.
+ */
+class ServerEngine {
+public:
+    explicit ServerEngine(WorkStealingPool &pool) : pool_(pool) {}
+
+    /**
+     * @brief Checks a request header
+     * @return Ok, or the status to answer with (the columns are then skipped)
+     */
+    static ServerStatus validate(const ServerFrameHeader &header) {
+        if (std::memcmp(header.magic, SERVER_REQUEST_MAGIC, sizeof(header.magic)) != 0 ||
+            header.version != SERVER_PROTOCOL_VERSION ||
+            header.kindOrStatus > static_cast<std::uint8_t>(ServerRequestKind::Stats)) {
+            return ServerStatus::BadRequest;
+        }
+        if (header.count > SERVER_MAX_BATCH) {
+            return ServerStatus::TooLarge;
+        }
+        return ServerStatus::Ok;
+    }
+
+    /**
+     * @brief Bytes of payload following a request header
+     */
+    static std::size_t requestPayloadSize(const ServerFrameHeader &header) {
+        if (header.kindOrStatus == static_cast<std::uint8_t>(ServerRequestKind::Stats)) {
+            return 0;
+        }
+        return 5 * sizeof(double) * static_cast<std::size_t>(header.count);
+    }
+
+    /**
+     * @brief Appends the response to a request to out
+     *
+     * A header that fails validate() gets a status-only response (count 0);
+     * the caller decides whether the connection can continue.
+     *
+     * @param columns  The request's five columns, 8-byte aligned (unused for Stats)
+     */
+    void respond(const ServerFrameHeader &request, const double *columns, std::vector<unsigned char> &out) {
+        ServerFrameHeader response;
+        std::memcpy(response.magic, SERVER_RESPONSE_MAGIC, sizeof(response.magic));
+        response.version = SERVER_PROTOCOL_VERSION;
+        response.kindOrStatus = static_cast<std::uint8_t>(validate(request));
+        response.flagsOrKind = request.kindOrStatus;
+        response.count = 0;
+        response.requestId = request.requestId;
+
+        std::size_t start = out.size();
+        if (response.kindOrStatus != static_cast<std::uint8_t>(ServerStatus::Ok)) {
+            ++stats_.rejected;
+            out.resize(start + sizeof(response));
+            std::memcpy(out.data() + start, &response, sizeof(response));
+            return;
+        }
+
+        ServerRequestKind kind = static_cast<ServerRequestKind>(request.kindOrStatus);
+        if (kind == ServerRequestKind::Stats) {
+            ServerStats snapshot = stats();
+            out.resize(start + sizeof(response) + sizeof(snapshot));
+            std::memcpy(out.data() + start, &response, sizeof(response));
+            std::memcpy(out.data() + start + sizeof(response), &snapshot, sizeof(snapshot));
+            return;
+        }
+
+        std::size_t count = request.count;
+        response.count = request.count;
+        out.resize(start + sizeof(response) + serverOutputColumns(kind) * count * sizeof(double));
+        std::memcpy(out.data() + start, &response, sizeof(response));
+        // The header is 16 bytes and every frame is a multiple of 8, so the
+        // output columns are 8-byte aligned like the input
+        double *results = reinterpret_cast<double *>(out.data() + start + sizeof(response));
+        evaluate(kind, request.flagsOrKind, columns, count, results);
+        ++stats_.requests;
+        stats_.points += count;
+    }
+
+    /**
+     * @brief Records the service latency of one batch request
+     */
+    void recordLatency(std::uint64_t nanoseconds) {
+        latency_.record(nanoseconds);
+    }
+
+    void recordClient() {
+        ++stats_.clients;
+    }
+
+    ServerStats stats() const {
+        ServerStats snapshot = stats_;
+        snapshot.p50Ns = latency_.percentile(0.50);
+        snapshot.p99Ns = latency_.percentile(0.99);
+        snapshot.maxNs = latency_.maximum();
+        return snapshot;
+    }
+
+private:
+    void evaluate(ServerRequestKind kind, std::uint8_t flags, const double *columns, std::size_t count,
+                  double *results) {
+        const double *x = columns;
+        const double *y = columns + count;
+        const double *theta = columns + 2 * count;
+        const double *dlead = columns + 3 * count;
+        const double *param = columns + 4 * count;
+        double *outX = results;
+        double *outY = results + count;
+        bool parallel = count >= SERVER_PARALLEL_THRESHOLD;
+
+        if (kind == ServerRequestKind::Boomerang) {
+            if (parallel) {
+                parallelBoomerangCarrotBatch(pool_, x, y, theta, dlead, param, count, outX, outY,
+                                             results + 2 * count, results + 3 * count);
+            } else {
+                boomerangCarrotBatch(x, y, theta, dlead, param, count, outX, outY,
+                                     results + 2 * count, results + 3 * count);
+            }
+            return;
+        }
+
+        if ((flags & SERVER_FLAG_CACHED) != 0) {
+            // One cache shared by all clients, so lookups stay on this thread
+            if (kind == ServerRequestKind::Curvature) {
+                cachedColinearPointWithCurvatureBatch(cache_, x, y, theta, dlead, param, count, outX, outY);
+            } else {
+                cachedColinearPointBatch(cache_, x, y, theta, dlead, param, count, outX, outY);
+            }
+            return;
+        }
+
+        BinaryParam shape = kind == ServerRequestKind::Curvature ? BinaryParam::Curvature : BinaryParam::Radius;
+        bool fast = (flags & SERVER_FLAG_FAST) != 0;
+        if (!parallel) {
+            binary_detail::evaluateChunk(shape, fast, x, y, theta, dlead, param, count, outX, outY);
+            return;
+        }
+        std::size_t chunk = parallel_detail::alignedChunkSize(PARALLEL_CHUNK_SIZE);
+        std::size_t chunkCount = (count + chunk - 1) / chunk;
+        pool_.parallelFor(chunkCount, [&](std::size_t c) {
+            std::size_t begin = c * chunk;
+            std::size_t n = count - begin < chunk ? count - begin : chunk;
+            binary_detail::evaluateChunk(shape, fast, x + begin, y + begin, theta + begin, dlead + begin,
+                                         param + begin, n, outX + begin, outY + begin);
+        });
+    }
+
+    WorkStealingPool &pool_;
+    ColinearPointCache cache_;
+    LatencyWindow latency_;
+    ServerStats stats_;
+};
+
+#if COLINEAR_HAVE_UNIX_SOCKETS
+
+namespace server_detail {
+
+inline volatile std::sig_atomic_t &stopRequested() {
+    static volatile std::sig_atomic_t flag = 0;
+    return flag;
+}
+
+extern "C" inline void handleStopSignal(int) {
+    stopRequested() = 1;
+}
+
+inline std::uint64_t nowNanoseconds() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+inline bool makeSocketAddress(const std::string &path, sockaddr_un &address, std::string &error) {
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        error = "socket path '" + path + "' is empty or too long";
+        return false;
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+
+inline bool writeAll(int fd, const void *data, std::size_t size) {
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    while (size > 0) {
+        ssize_t n = ::write(fd, p, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        size -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+inline bool readAll(int fd, void *data, std::size_t size) {
+    unsigned char *p = static_cast<unsigned char *>(data);
+    while (size > 0) {
+        ssize_t n = ::read(fd, p, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        size -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+}  // namespace server_detail
+
+// ============================================
+// Unix Socket Server
+// ============================================
+/**
+ * @brief Single-threaded poll() loop serving the request protocol
+ *
+ * Sockets are non-blocking. Each connection has a receive buffer that
+ * holds at least one whole frame and a send buffer of pending responses;
+ * a connection with unsent responses is not read from, so a client that
+ * stops reading cannot make the server buffer without bound. A client
+ * that half-closes its socket after its last request still gets every
+ * response: the connection closes once those are sent. Large
+ * batches fan out to the engine's thread pool, so the loop itself never
+ * needs more than one thread.
+ */
+class ColinearServer {
+public:
+    explicit ColinearServer(ServerEngine &engine) : engine_(engine) {}
+    ColinearServer(const ColinearServer &) = delete;
+    ColinearServer &operator=(const ColinearServer &) = delete;
+
+    ~ColinearServer() {
+        for (Connection &c : connections_) {
+            ::close(c.fd);
+        }
+        if (listenFd_ >= 0) {
+            ::close(listenFd_);
+            ::unlink(path_.c_str());
+        }
+    }
+
+    /**
+     * @brief Binds and listens on a Unix socket (mode 0600)
+     *
+     * A stale socket file left by a dead server is replaced; a path with a
+     * live server behind it is an error.
+     */
+    bool listen(const std::string &path, std::string &error) {
+        sockaddr_un address;
+        if (!server_detail::makeSocketAddress(path, address, error)) {
+            return false;
+        }
+        struct stat st;
+        if (::lstat(path.c_str(), &st) == 0) {
+            if (!S_ISSOCK(st.st_mode)) {
+                error = "'" + path + "' exists and is not a socket";
+                return false;
+            }
+            int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            bool live = probe >= 0 &&
+                        ::connect(probe, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0;
+            if (probe >= 0) {
+                ::close(probe);
+            }
+            if (live) {
+                error = "a server is already listening on '" + path + "'";
+                return false;
+            }
+            ::unlink(path.c_str());
+        }
+
+        listenFd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listenFd_ < 0) {
+            error = "cannot create socket";
+            return false;
+        }
+        mode_t previousMask = ::umask(0177);
+        int bound = ::bind(listenFd_, reinterpret_cast<const sockaddr *>(&address), sizeof(address));
+        ::umask(previousMask);
+        if (bound != 0 || ::listen(listenFd_, 64) != 0) {
+            ::close(listenFd_);
+            listenFd_ = -1;
+            error = "cannot listen on '" + path + "'";
+            return false;
+        }
+        setNonBlocking(listenFd_);
+        path_ = path;
+        return true;
+    }
+
+    /**
+     * @brief Serves until stop is set (checked at least every pollMs)
+     */
+    void run(const volatile std::sig_atomic_t &stop, int pollMs = 200) {
+        std::vector<pollfd> fds;
+        while (!stop) {
+            fds.clear();
+            fds.push_back(pollfd{listenFd_, POLLIN, 0});
+            for (const Connection &c : connections_) {
+                short events = c.sent < c.out.size() ? POLLOUT : POLLIN;
+                fds.push_back(pollfd{c.fd, events, 0});
+            }
+            int ready = ::poll(fds.data(), static_cast<nfds_t>(fds.size()), pollMs);
+            if (ready <= 0) {
+                continue;
+            }
+
+            // Walk backwards so closing a connection does not shift the
+            // entries still to be visited
+            for (std::size_t i = fds.size() - 1; i > 0; --i) {
+                Connection &c = connections_[i - 1];
+                bool keep = true;
+                if ((fds[i].revents & (POLLERR | POLLNVAL)) != 0) {
+                    keep = false;
+                } else if ((fds[i].revents & POLLOUT) != 0) {
+                    keep = flush(c) && (c.sent < c.out.size() || serveBuffered(c)) && hasWork(c);
+                } else if ((fds[i].revents & (POLLIN | POLLHUP)) != 0) {
+                    keep = receive(c);
+                }
+                if (!keep) {
+                    ::close(c.fd);
+                    connections_.erase(connections_.begin() + static_cast<std::ptrdiff_t>(i - 1));
+                }
+            }
+            if ((fds[0].revents & POLLIN) != 0) {
+                accept();
+            }
+        }
+    }
+
+private:
+    struct Connection {
+        int fd = -1;
+        std::vector<unsigned char> in;   // Received bytes [0, received)
+        std::size_t received = 0;
+        std::vector<unsigned char> out;  // Responses [sent, out.size()) still to send
+        std::size_t sent = 0;
+        std::vector<std::uint64_t> pendingStart;  // Frame-complete timestamps of unsent batch responses
+        bool peerClosed = false;         // read() returned 0: no more requests will arrive
+    };
+
+    /**
+     * @brief False once the peer has closed and every response is sent
+     *
+     * A partial frame left in the buffer at that point can never complete.
+     */
+    static bool hasWork(const Connection &c) {
+        return !c.peerClosed || c.sent < c.out.size();
+    }
+
+    static void setNonBlocking(int fd) {
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    }
+
+    void accept() {
+        for (;;) {
+            int fd = ::accept(listenFd_, nullptr, nullptr);
+            if (fd < 0) {
+                return;
+            }
+            setNonBlocking(fd);
+            Connection c;
+            c.fd = fd;
+            c.in.resize(1 << 16);
+            connections_.push_back(std::move(c));
+            engine_.recordClient();
+        }
+    }
+
+    /**
+     * @brief Reads what is available and serves every complete frame
+     * @return false on a read error or bad frame, or once the peer has
+     *         closed and every frame it sent is answered
+     */
+    bool receive(Connection &c) {
+        // The buffer only grows to the size of the frame being received,
+        // so a client pipelining many requests is served in installments
+        while (c.received < c.in.size()) {
+            ssize_t n = ::read(c.fd, c.in.data() + c.received, c.in.size() - c.received);
+            if (n > 0) {
+                c.received += static_cast<std::size_t>(n);
+                continue;
+            }
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                break;
+            }
+            if (n == 0) {
+                // Half-closed or hung up: answer what already arrived first
+                c.peerClosed = true;
+                break;
+            }
+            return false;
+        }
+        return serveBuffered(c) && flush(c) && hasWork(c);
+    }
+
+    /**
+     * @brief Serves complete frames from the receive buffer while nothing is pending
+     */
+    bool serveBuffered(Connection &c) {
+        std::size_t offset = 0;
+        bool ok = true;
+        while (c.sent == c.out.size() && c.received - offset >= sizeof(ServerFrameHeader)) {
+            ServerFrameHeader header;
+            std::memcpy(&header, c.in.data() + offset, sizeof(header));
+            ServerStatus status = ServerEngine::validate(header);
+            if (status != ServerStatus::Ok) {
+                // The payload length cannot be trusted: answer and hang up
+                engine_.respond(header, nullptr, c.out);
+                flush(c);
+                ok = false;
+                break;
+            }
+            std::size_t frame = sizeof(header) + ServerEngine::requestPayloadSize(header);
+            if (c.received - offset < frame) {
+                if (c.in.size() < frame) {
+                    c.in.resize(frame);
+                }
+                break;
+            }
+            std::uint64_t start = server_detail::nowNanoseconds();
+            c.out.clear();
+            c.sent = 0;
+            engine_.respond(header, reinterpret_cast<const double *>(c.in.data() + offset + sizeof(header)), c.out);
+            if (header.kindOrStatus != static_cast<std::uint8_t>(ServerRequestKind::Stats)) {
+                c.pendingStart.push_back(start);
+            }
+            offset += frame;
+            if (!flush(c)) {
+                ok = false;
+                break;
+            }
+        }
+        // Keep the unconsumed tail at the start of the buffer (8-aligned)
+        if (offset > 0) {
+            std::memmove(c.in.data(), c.in.data() + offset, c.received - offset);
+            c.received -= offset;
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Sends pending responses; records latency once a response is fully sent
+     */
+    bool flush(Connection &c) {
+        while (c.sent < c.out.size()) {
+            ssize_t n = ::send(c.fd, c.out.data() + c.sent, c.out.size() - c.sent, MSG_NOSIGNAL);
+            if (n > 0) {
+                c.sent += static_cast<std::size_t>(n);
+                continue;
+            }
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                return true;
+            }
+            return false;
+        }
+        std::uint64_t end = server_detail::nowNanoseconds();
+        for (std::uint64_t start : c.pendingStart) {
+            engine_.recordLatency(end - start);
+        }
+        c.pendingStart.clear();
+        return true;
+    }
+
+    ServerEngine &engine_;
+    int listenFd_ = -1;
+    std::string path_;
+    std::vector<Connection> connections_;
+};
+
+// ============================================
+// Client
+// ============================================
+/**
+ * @brief Blocking client for a ColinearServer
+ *
+ * Batches larger than SERVER_MAX_BATCH are split into several requests.
+ * Every call returns false on a connection or protocol error; the
+ * connection should then be reopened.
+ */
+class ColinearClient {
+public:
+    ColinearClient() = default;
+    ColinearClient(const ColinearClient &) = delete;
+    ColinearClient &operator=(const ColinearClient &) = delete;
+
+    ~ColinearClient() {
+        close();
+    }
+
+    bool connect(const std::string &path, std::string &error) {
+        close();
+        sockaddr_un address;
+        if (!server_detail::makeSocketAddress(path, address, error)) {
+            return false;
+        }
+        fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd_ < 0 || ::connect(fd_, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0) {
+            close();
+            error = "cannot connect to '" + path + "'";
+            return false;
+        }
+        return true;
+    }
+
+    void close() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    /**
+     * @brief calculateColinearPointBatch() on the server
+     * @param flags  SERVER_FLAG_FAST and/or SERVER_FLAG_CACHED
+     */
+    bool colinearPointBatch(const double *x, const double *y, const double *theta, const double *dlead,
+                            const double *radius, std::size_t count, double *outX, double *outY,
+                            std::uint8_t flags = 0) {
+        double *outputs[2] = {outX, outY};
+        return call(ServerRequestKind::Arc, flags, x, y, theta, dlead, radius, count, outputs);
+    }
+
+    /**
+     * @brief calculateColinearPointWithCurvatureBatch() on the server
+     */
+    bool colinearPointWithCurvatureBatch(const double *x, const double *y, const double *theta, const double *dlead,
+                                         const double *curvature, std::size_t count, double *outX, double *outY,
+                                         std::uint8_t flags = 0) {
+        double *outputs[2] = {outX, outY};
+        return call(ServerRequestKind::Curvature, flags, x, y, theta, dlead, curvature, count, outputs);
+    }
+
+    /**
+     * @brief boomerangCarrotBatch() on the server
+     */
+    bool boomerangCarrotBatch(const double *x, const double *y, const double *theta, const double *dlead,
+                              const double *radius, std::size_t count, double *outCarrotX, double *outCarrotY,
+                              double *outChordBearing, double *outChordLength) {
+        double *outputs[4] = {outCarrotX, outCarrotY, outChordBearing, outChordLength};
+        return call(ServerRequestKind::Boomerang, 0, x, y, theta, dlead, radius, count, outputs);
+    }
+
+    bool stats(ServerStats &out) {
+        ServerFrameHeader request = makeServerRequestHeader(ServerRequestKind::Stats, 0, 0, nextId_++);
+        ServerFrameHeader response;
+        return server_detail::writeAll(fd_, &request, sizeof(request)) &&
+               server_detail::readAll(fd_, &response, sizeof(response)) &&
+               checkResponse(request, response) &&
+               server_detail::readAll(fd_, &out, sizeof(out));
+    }
+
+private:
+    bool call(ServerRequestKind kind, std::uint8_t flags, const double *x, const double *y, const double *theta,
+              const double *dlead, const double *param, std::size_t count, double **outputs) {
+        std::size_t outputCount = serverOutputColumns(kind);
+        for (std::size_t begin = 0; begin < count; begin += SERVER_MAX_BATCH) {
+            std::size_t n = count - begin < SERVER_MAX_BATCH ? count - begin : SERVER_MAX_BATCH;
+            ServerFrameHeader request = makeServerRequestHeader(kind, flags, static_cast<std::uint32_t>(n), nextId_++);
+
+            // Header and columns go out in one gather write, with no copy
+            const double *columns[5] = {x, y, theta, dlead, param};
+            iovec parts[6];
+            parts[0].iov_base = &request;
+            parts[0].iov_len = sizeof(request);
+            for (int c = 0; c < 5; ++c) {
+                parts[c + 1].iov_base = const_cast<double *>(columns[c] + begin);
+                parts[c + 1].iov_len = n * sizeof(double);
+            }
+            if (!writeVector(parts, 6)) {
+                return false;
+            }
+
+            ServerFrameHeader response;
+            if (!server_detail::readAll(fd_, &response, sizeof(response)) || !checkResponse(request, response) ||
+                response.count != request.count) {
+                return false;
+            }
+            for (std::size_t c = 0; c < outputCount; ++c) {
+                if (!server_detail::readAll(fd_, outputs[c] + begin, n * sizeof(double))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    static bool checkResponse(const ServerFrameHeader &request, const ServerFrameHeader &response) {
+        return std::memcmp(response.magic, SERVER_RESPONSE_MAGIC, sizeof(response.magic)) == 0 &&
+               response.kindOrStatus == static_cast<std::uint8_t>(ServerStatus::Ok) &&
+               response.requestId == request.requestId;
+    }
+
+    bool writeVector(iovec *parts, int partCount) {
+        while (partCount > 0) {
+            ssize_t n = ::writev(fd_, parts, partCount);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                return false;
+            }
+            std::size_t done = static_cast<std::size_t>(n);
+            while (partCount > 0 && done >= parts->iov_len) {
+                done -= parts->iov_len;
+                ++parts;
+                --partCount;
+            }
+            if (partCount > 0) {
+                parts->iov_base = static_cast<unsigned char *>(parts->iov_base) + done;
+                parts->iov_len -= done;
+            }
+        }
+        return true;
+    }
+
+    int fd_ = -1;
+    std::uint32_t nextId_ = 1;
+};
+
+#endif  // COLINEAR_HAVE_UNIX_SOCKETS
+
+// ============================================
+// --serve Entry Point
+// ============================================
+inline void printServerStats(const ServerStats &stats, std::FILE *out) {
+    std::fprintf(out,
+        "requests %llu  points %llu  rejected %llu  clients %llu  "
+        "latency p50 %.1f us  p99 %.1f us  max %.1f us\n",
+        static_cast<unsigned long long>(stats.requests), static_cast<unsigned long long>(stats.points),
+        static_cast<unsigned long long>(stats.rejected), static_cast<unsigned long long>(stats.clients),
+        static_cast<double>(stats.p50Ns) * 1e-3, static_cast<double>(stats.p99Ns) * 1e-3,
+        static_cast<double>(stats.maxNs) * 1e-3);
+}
+
+/**
+ * @brief Serves requests on options.servePath until SIGINT or SIGTERM
+ *
+ * The final counters and latency percentiles are printed to stderr.
+ *
+ * @return 0 after a clean shutdown, 1 if the socket could not be opened
+ */
+inline int runServer(const StreamOptions &options) {
+#if COLINEAR_HAVE_UNIX_SOCKETS
+    WorkStealingPool pool;
+    ServerEngine engine(pool);
+    ColinearServer server(engine);
+    std::string error;
+    if (!server.listen(options.servePath, error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+
+    // No SA_RESTART, so a signal also cuts the current poll() short
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = server_detail::handleStopSignal;
+    sigemptyset(&action.sa_mask);
+    ::sigaction(SIGINT, &action, nullptr);
+    ::sigaction(SIGTERM, &action, nullptr);
+
+    std::fprintf(stderr, "serving on %s (%u threads)\n", options.servePath.c_str(), pool.threadCount());
+    server.run(server_detail::stopRequested());
+    printServerStats(engine.stats(), stderr);
+    return 0;
+#else
+    (void)options;
+    std::fprintf(stderr, "error: --serve needs Unix domain sockets, which this platform lacks\n");
+    return 1;
+#endif
+}
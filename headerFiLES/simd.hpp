@@ -0,0 +1,484 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "geometry.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define COLINEAR_SIMD_X86 1
+    #include <immintrin.h>
+#else
+    #define COLINEAR_SIMD_X86 0
+#endif
+
+// ============================================
+// SIMD Boomerang Curve Kernels
+// ============================================
+// Hand-vectorized versions of calculateColinearPointBatch() and
+// calculateColinearPointWithCurvatureBatch(). The trig is replaced by a
+// polynomial sincos so no lane ever calls into scalar libm, and the
+// MIN_DLEAD / MAX_DLEAD / zero-radius branches become lane masks.
+//
+// The instruction set is picked once at runtime (AVX-512F, AVX2+FMA,
+// otherwise the scalar batch loop). On non-x86 targets the scalar batch
+// loop is always used.
+//
+// Accuracy (measured against glibc sin/cos, |arg| <= SIMD_TRIG_MAX_ARG):
+// - the polynomial sincos is within 2 ULP of libm sin and cos
+// - output x/y differ from the scalar reference by at most
+//   5 ULP of max(|x|, |y|, radius, 1) for the arc, and of
+//   max(|x|, |y|, |dlead|, 1) for the straight line
+// Lanes whose reduced angle would exceed SIMD_TRIG_MAX_ARG (or are not
+// finite) are recomputed with the scalar reference, so they are exact.
+// The EPSILON cleanup is applied to the SIMD result, so a value sitting
+// within a few ULP of EPSILON may snap differently than the scalar path.
+
+const double SIMD_TRIG_MAX_ARG = 1e5;  // Largest |angle| reduced in-register
+
+enum class SimdLevel {
+    Scalar,
+    Avx2,
+    Avx512
+};
+
+/**
+ * @brief Human readable name of a SIMD level (for logging/benchmarks)
+ */
+inline const char *simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Avx512: return "avx512";
+        case SimdLevel::Avx2:   return "avx2";
+        default:                return "scalar";
+    }
+}
+
+/**
+ * @brief Best SIMD level supported by the running CPU
+ */
+inline SimdLevel detectSimdLevel() {
+#if COLINEAR_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SimdLevel::Avx2;
+    }
+#endif
+    return SimdLevel::Scalar;
+}
+
+// ============================================
+// Polynomial sincos coefficients
+// ============================================
+// Minimax polynomials on [-pi/4, pi/4] (fdlibm __kernel_sin/__kernel_cos)
+// and a three-part Cody-Waite split of pi/2 for the argument reduction.
+namespace simd_detail {
+
+const double TWO_OVER_PI = 6.36619772367581382433e-01;
+const double PIO2_1 = 1.57079632673412561417e+00;
+const double PIO2_2 = 6.07710050630396597660e-11;
+const double PIO2_3 = 2.02226624871116645580e-21;
+
+const double S1 = -1.66666666666666324348e-01;
+const double S2 =  8.33333333332248946124e-03;
+const double S3 = -1.98412698298579493134e-04;
+const double S4 =  2.75573137070700676789e-06;
+const double S5 = -2.50507602534068634195e-08;
+const double S6 =  1.58969099521155010221e-10;
+
+const double C1 =  4.16666666666666019037e-02;
+const double C2 = -1.38888888888741095749e-03;
+const double C3 =  2.48015872894767294178e-05;
+const double C4 = -2.75573143513906633035e-07;
+const double C5 =  2.08757232129817482790e-09;
+const double C6 = -1.13596475577881948265e-11;
+
+/**
+ * @brief Scalar model of the vector sincos (for accuracy checks)
+ */
+inline void simdSinCos(double a, double &s, double &c) {
+    double k = std::nearbyint(a * TWO_OVER_PI);
+    double r = std::fma(-k, PIO2_1, a);
+    r = std::fma(-k, PIO2_2, r);
+    r = std::fma(-k, PIO2_3, r);
+    double z = r * r;
+    double ps = S2 + z * (S3 + z * (S4 + z * (S5 + z * S6)));
+    double sr = r + r * z * (S1 + z * ps);
+    double pc = C1 + z * (C2 + z * (C3 + z * (C4 + z * (C5 + z * C6))));
+    double cr = 1.0 - 0.5 * z + z * z * pc;
+    long q = static_cast<long>(k) & 3;
+    s = (q & 1) ? cr : sr;
+    c = (q & 1) ? sr : cr;
+    if (q == 1 || q == 2) c = -c;
+    if (q >= 2) s = -s;
+}
+
+#if COLINEAR_SIMD_X86
+
+// ============================================
+// AVX2 + FMA (4 lanes)
+// ============================================
+__attribute__((target("avx2,fma")))
+inline void sinCosAvx2(__m256d a, __m256d &s, __m256d &c) {
+    __m256d k = _mm256_round_pd(_mm256_mul_pd(a, _mm256_set1_pd(TWO_OVER_PI)),
+                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = _mm256_fnmadd_pd(k, _mm256_set1_pd(PIO2_1), a);
+    r = _mm256_fnmadd_pd(k, _mm256_set1_pd(PIO2_2), r);
+    r = _mm256_fnmadd_pd(k, _mm256_set1_pd(PIO2_3), r);
+    __m256d z = _mm256_mul_pd(r, r);
+
+    __m256d ps = _mm256_fmadd_pd(z, _mm256_set1_pd(S6), _mm256_set1_pd(S5));
+    ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(S4));
+    ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(S3));
+    ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(S2));
+    ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(S1));
+    __m256d sr = _mm256_fmadd_pd(_mm256_mul_pd(r, z), ps, r);
+
+    __m256d pc = _mm256_fmadd_pd(z, _mm256_set1_pd(C6), _mm256_set1_pd(C5));
+    pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(C4));
+    pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(C3));
+    pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(C2));
+    pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(C1));
+    __m256d cr = _mm256_fmadd_pd(_mm256_mul_pd(z, z), pc,
+                                 _mm256_fnmadd_pd(_mm256_set1_pd(0.5), z, _mm256_set1_pd(1.0)));
+
+    // Quadrant q = k mod 4, kept in floating point to avoid int shuffles
+    __m256d q = _mm256_sub_pd(k, _mm256_mul_pd(_mm256_set1_pd(4.0),
+                _mm256_floor_pd(_mm256_mul_pd(k, _mm256_set1_pd(0.25)))));
+    __m256d odd = _mm256_cmp_pd(_mm256_sub_pd(q, _mm256_mul_pd(_mm256_set1_pd(2.0),
+                  _mm256_floor_pd(_mm256_mul_pd(q, _mm256_set1_pd(0.5))))),
+                  _mm256_set1_pd(0.5), _CMP_GT_OQ);
+    __m256d sinNeg = _mm256_cmp_pd(q, _mm256_set1_pd(1.5), _CMP_GT_OQ);
+    __m256d cosNeg = _mm256_and_pd(_mm256_cmp_pd(q, _mm256_set1_pd(0.5), _CMP_GT_OQ),
+                                   _mm256_cmp_pd(q, _mm256_set1_pd(2.5), _CMP_LT_OQ));
+    __m256d signBit = _mm256_set1_pd(-0.0);
+    s = _mm256_blendv_pd(sr, cr, odd);
+    c = _mm256_blendv_pd(cr, sr, odd);
+    s = _mm256_xor_pd(s, _mm256_and_pd(sinNeg, signBit));
+    c = _mm256_xor_pd(c, _mm256_and_pd(cosNeg, signBit));
+}
+
+/**
+ * @brief AVX2 arc/straight kernel for one block of 4 lanes
+ * @return false if a lane needs the scalar reference (huge or non-finite angle)
+ */
+template <bool kCurvature>
+__attribute__((target("avx2,fma")))
+inline bool arcBlockAvx2(
+    const double *x, const double *y, const double *theta,
+    const double *dlead, const double *param,
+    double *outX, double *outY
+) {
+    __m256d signBit = _mm256_set1_pd(-0.0);
+    __m256d px = _mm256_loadu_pd(x);
+    __m256d py = _mm256_loadu_pd(y);
+    __m256d th = _mm256_loadu_pd(theta);
+    __m256d d0 = _mm256_loadu_pd(dlead);
+    __m256d p = _mm256_loadu_pd(param);
+    __m256d eps = _mm256_set1_pd(EPSILON);
+    __m256d limit = _mm256_set1_pd(SIMD_TRIG_MAX_ARG);
+
+    __m256d straight = _mm256_setzero_pd();
+    __m256d d = d0;
+    __m256d r;
+    if (kCurvature) {
+        // Straight lanes get a dummy radius; the arc result is discarded
+        __m256d absC = _mm256_andnot_pd(signBit, p);
+        straight = _mm256_cmp_pd(absC, eps, _CMP_LT_OQ);
+        d = _mm256_xor_pd(d, _mm256_and_pd(p, signBit));
+        r = _mm256_blendv_pd(_mm256_div_pd(_mm256_set1_pd(1.0), absC),
+                             _mm256_set1_pd(DEFAULT_CURVATURE_RADIUS), straight);
+        // |c| > 1 / EPSILON: same zero-radius fallback as calculateColinearPoint()
+        r = _mm256_blendv_pd(r, _mm256_set1_pd(DEFAULT_CURVATURE_RADIUS), _mm256_cmp_pd(r, eps, _CMP_LT_OQ));
+    } else {
+        __m256d absR = _mm256_andnot_pd(signBit, p);
+        r = _mm256_blendv_pd(absR, _mm256_set1_pd(DEFAULT_CURVATURE_RADIUS),
+                             _mm256_cmp_pd(absR, eps, _CMP_LT_OQ));
+    }
+
+    __m256d stay = _mm256_cmp_pd(_mm256_andnot_pd(signBit, d),
+                                 _mm256_set1_pd(MIN_DLEAD), _CMP_LT_OQ);
+    d = _mm256_min_pd(_mm256_max_pd(d, _mm256_set1_pd(-MAX_DLEAD)), _mm256_set1_pd(MAX_DLEAD));
+    __m256d phi = _mm256_div_pd(d, r);
+
+    // Unordered compare so NaN lanes also take the scalar path
+    __m256d bad = _mm256_or_pd(
+        _mm256_andnot_pd(straight, _mm256_cmp_pd(_mm256_andnot_pd(signBit, phi), limit, _CMP_NLE_UQ)),
+        _mm256_cmp_pd(_mm256_andnot_pd(signBit, th), limit, _CMP_NLE_UQ));
+    bad = _mm256_or_pd(bad, _mm256_cmp_pd(d0, d0, _CMP_UNORD_Q));
+    if (_mm256_movemask_pd(bad) != 0) {
+        return false;
+    }
+
+    __m256d sinPhi, cosPhi, sinTheta, cosTheta;
+    sinCosAvx2(phi, sinPhi, cosPhi);
+    sinCosAvx2(th, sinTheta, cosTheta);
+
+    __m256d localX = _mm256_mul_pd(r, sinPhi);
+    __m256d localY = _mm256_mul_pd(r, _mm256_sub_pd(_mm256_set1_pd(1.0), cosPhi));
+    __m256d rx = _mm256_fnmadd_pd(localY, sinTheta, _mm256_fmadd_pd(localX, cosTheta, px));
+    __m256d ry = _mm256_fmadd_pd(localY, cosTheta, _mm256_fmadd_pd(localX, sinTheta, py));
+
+    // Numerical precision cleanup, then the MIN_DLEAD early-return lanes
+    rx = _mm256_andnot_pd(_mm256_cmp_pd(_mm256_andnot_pd(signBit, rx), eps, _CMP_LT_OQ), rx);
+    ry = _mm256_andnot_pd(_mm256_cmp_pd(_mm256_andnot_pd(signBit, ry), eps, _CMP_LT_OQ), ry);
+    rx = _mm256_blendv_pd(rx, px, stay);
+    ry = _mm256_blendv_pd(ry, py, stay);
+
+    if (kCurvature) {
+        __m256d sx = _mm256_fmadd_pd(d0, cosTheta, px);
+        __m256d sy = _mm256_fmadd_pd(d0, sinTheta, py);
+        rx = _mm256_blendv_pd(rx, sx, straight);
+        ry = _mm256_blendv_pd(ry, sy, straight);
+    }
+
+    _mm256_storeu_pd(outX, rx);
+    _mm256_storeu_pd(outY, ry);
+    return true;
+}
+
+// ============================================
+// AVX-512F (8 lanes)
+// ============================================
+// GCC 12 warns about the _mm512_undefined_pd() passthrough used inside
+// its own intrinsic wrappers; the value is never read.
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wuninitialized"
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f")))
+inline __m512d negateMasked512(__m512d v, __mmask8 m) {
+    __m512i signBit = _mm512_set1_epi64(static_cast<long long>(0x8000000000000000ULL));
+    __m512i bits = _mm512_castpd_si512(v);
+    return _mm512_castsi512_pd(_mm512_mask_xor_epi64(bits, m, bits, signBit));
+}
+
+__attribute__((target("avx512f")))
+inline void sinCosAvx512(__m512d a, __m512d &s, __m512d &c) {
+    __m512d k = _mm512_roundscale_pd(_mm512_mul_pd(a, _mm512_set1_pd(TWO_OVER_PI)),
+                                     _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m512d r = _mm512_fnmadd_pd(k, _mm512_set1_pd(PIO2_1), a);
+    r = _mm512_fnmadd_pd(k, _mm512_set1_pd(PIO2_2), r);
+    r = _mm512_fnmadd_pd(k, _mm512_set1_pd(PIO2_3), r);
+    __m512d z = _mm512_mul_pd(r, r);
+
+    __m512d ps = _mm512_fmadd_pd(z, _mm512_set1_pd(S6), _mm512_set1_pd(S5));
+    ps = _mm512_fmadd_pd(z, ps, _mm512_set1_pd(S4));
+    ps = _mm512_fmadd_pd(z, ps, _mm512_set1_pd(S3));
+    ps = _mm512_fmadd_pd(z, ps, _mm512_set1_pd(S2));
+    ps = _mm512_fmadd_pd(z, ps, _mm512_set1_pd(S1));
+    __m512d sr = _mm512_fmadd_pd(_mm512_mul_pd(r, z), ps, r);
+
+    __m512d pc = _mm512_fmadd_pd(z, _mm512_set1_pd(C6), _mm512_set1_pd(C5));
+    pc = _mm512_fmadd_pd(z, pc, _mm512_set1_pd(C4));
+    pc = _mm512_fmadd_pd(z, pc, _mm512_set1_pd(C3));
+    pc = _mm512_fmadd_pd(z, pc, _mm512_set1_pd(C2));
+    pc = _mm512_fmadd_pd(z, pc, _mm512_set1_pd(C1));
+    __m512d cr = _mm512_fmadd_pd(_mm512_mul_pd(z, z), pc,
+                                 _mm512_fnmadd_pd(_mm512_set1_pd(0.5), z, _mm512_set1_pd(1.0)));
+
+    __m512d q = _mm512_sub_pd(k, _mm512_mul_pd(_mm512_set1_pd(4.0),
+                _mm512_roundscale_pd(_mm512_mul_pd(k, _mm512_set1_pd(0.25)), _MM_FROUND_TO_NEG_INF)));
+    __m512d qHalf = _mm512_roundscale_pd(_mm512_mul_pd(q, _mm512_set1_pd(0.5)), _MM_FROUND_TO_NEG_INF);
+    __mmask8 odd = _mm512_cmp_pd_mask(_mm512_sub_pd(q, _mm512_add_pd(qHalf, qHalf)),
+                                      _mm512_set1_pd(0.5), _CMP_GT_OQ);
+    __mmask8 sinNeg = _mm512_cmp_pd_mask(q, _mm512_set1_pd(1.5), _CMP_GT_OQ);
+    __mmask8 cosNeg = _mm512_cmp_pd_mask(q, _mm512_set1_pd(0.5), _CMP_GT_OQ)
+                    & _mm512_cmp_pd_mask(q, _mm512_set1_pd(2.5), _CMP_LT_OQ);
+    s = negateMasked512(_mm512_mask_blend_pd(odd, sr, cr), sinNeg);
+    c = negateMasked512(_mm512_mask_blend_pd(odd, cr, sr), cosNeg);
+}
+
+/**
+ * @brief AVX-512 arc/straight kernel for one block of 8 lanes
+ * @return false if a lane needs the scalar reference (huge or non-finite angle)
+ */
+template <bool kCurvature>
+__attribute__((target("avx512f")))
+inline bool arcBlockAvx512(
+    const double *x, const double *y, const double *theta,
+    const double *dlead, const double *param,
+    double *outX, double *outY
+) {
+    __m512d px = _mm512_loadu_pd(x);
+    __m512d py = _mm512_loadu_pd(y);
+    __m512d th = _mm512_loadu_pd(theta);
+    __m512d d0 = _mm512_loadu_pd(dlead);
+    __m512d p = _mm512_loadu_pd(param);
+    __m512d eps = _mm512_set1_pd(EPSILON);
+    __m512d limit = _mm512_set1_pd(SIMD_TRIG_MAX_ARG);
+
+    __mmask8 straight = 0;
+    __m512d d = d0;
+    __m512d r;
+    if (kCurvature) {
+        __m512d absC = _mm512_abs_pd(p);
+        straight = _mm512_cmp_pd_mask(absC, eps, _CMP_LT_OQ);
+        d = negateMasked512(d, _mm512_cmp_pd_mask(p, _mm512_setzero_pd(), _CMP_LT_OQ));
+        r = _mm512_mask_blend_pd(straight, _mm512_div_pd(_mm512_set1_pd(1.0), absC),
+                                 _mm512_set1_pd(DEFAULT_CURVATURE_RADIUS));
+        r = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(r, eps, _CMP_LT_OQ), r,
+                                 _mm512_set1_pd(DEFAULT_CURVATURE_RADIUS));
+    } else {
+        __m512d absR = _mm512_abs_pd(p);
+        r = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(absR, eps, _CMP_LT_OQ), absR,
+                                 _mm512_set1_pd(DEFAULT_CURVATURE_RADIUS));
+    }
+
+    __mmask8 stay = _mm512_cmp_pd_mask(_mm512_abs_pd(d), _mm512_set1_pd(MIN_DLEAD), _CMP_LT_OQ);
+    d = _mm512_min_pd(_mm512_max_pd(d, _mm512_set1_pd(-MAX_DLEAD)), _mm512_set1_pd(MAX_DLEAD));
+    __m512d phi = _mm512_div_pd(d, r);
+
+    __mmask8 bad = (_mm512_cmp_pd_mask(_mm512_abs_pd(phi), limit, _CMP_NLE_UQ) & ~straight)
+                 | _mm512_cmp_pd_mask(_mm512_abs_pd(th), limit, _CMP_NLE_UQ)
+                 | _mm512_cmp_pd_mask(d0, d0, _CMP_UNORD_Q);
+    if (bad != 0) {
+        return false;
+    }
+
+    __m512d sinPhi, cosPhi, sinTheta, cosTheta;
+    sinCosAvx512(phi, sinPhi, cosPhi);
+    sinCosAvx512(th, sinTheta, cosTheta);
+
+    __m512d localX = _mm512_mul_pd(r, sinPhi);
+    __m512d localY = _mm512_mul_pd(r, _mm512_sub_pd(_mm512_set1_pd(1.0), cosPhi));
+    __m512d rx = _mm512_fnmadd_pd(localY, sinTheta, _mm512_fmadd_pd(localX, cosTheta, px));
+    __m512d ry = _mm512_fmadd_pd(localY, cosTheta, _mm512_fmadd_pd(localX, sinTheta, py));
+
+    rx = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(_mm512_abs_pd(rx), eps, _CMP_LT_OQ), rx, _mm512_setzero_pd());
+    ry = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(_mm512_abs_pd(ry), eps, _CMP_LT_OQ), ry, _mm512_setzero_pd());
+    rx = _mm512_mask_blend_pd(stay, rx, px);
+    ry = _mm512_mask_blend_pd(stay, ry, py);
+
+    if (kCurvature) {
+        rx = _mm512_mask_blend_pd(straight, rx, _mm512_fmadd_pd(d0, cosTheta, px));
+        ry = _mm512_mask_blend_pd(straight, ry, _mm512_fmadd_pd(d0, sinTheta, py));
+    }
+
+    _mm512_storeu_pd(outX, rx);
+    _mm512_storeu_pd(outY, ry);
+    return true;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic pop
+#endif
+
+#endif  // COLINEAR_SIMD_X86
+
+// ============================================
+// Block drivers
+// ============================================
+// Walks the arrays in blocks of the vector width. Blocks that contain a
+// lane the polynomial cannot handle, and the final partial block, go
+// through the scalar batch reference so semantics never diverge.
+typedef void (*BatchFn)(const double *, const double *, const double *,
+                        const double *, const double *, std::size_t,
+                        double *, double *);
+typedef bool (*BlockFn)(const double *, const double *, const double *,
+                        const double *, const double *, double *, double *);
+
+inline void runBlocks(
+    BlockFn block, std::size_t width, BatchFn reference,
+    const double *x, const double *y, const double *theta,
+    const double *dlead, const double *param, std::size_t count,
+    double *outX, double *outY
+) {
+    COLINEAR_TALLY_DECLARE(tally);
+    std::size_t i = 0;
+    for (; i + width <= count; i += width) {
+        COLINEAR_TALLY(tally, SimdBlock, 1);
+        if (!block(x + i, y + i, theta + i, dlead + i, param + i, outX + i, outY + i)) {
+            COLINEAR_TALLY(tally, SimdFallbackBlock, 1);
+            reference(x + i, y + i, theta + i, dlead + i, param + i, width, outX + i, outY + i);
+        }
+    }
+    COLINEAR_TALLY_PUBLISH(tally);
+    if (i < count) {
+        reference(x + i, y + i, theta + i, dlead + i, param + i, count - i, outX + i, outY + i);
+    }
+}
+
+template <bool kCurvature>
+inline void dispatchBatch(
+    SimdLevel level,
+    const double *x, const double *y, const double *theta,
+    const double *dlead, const double *param, std::size_t count,
+    double *outX, double *outY
+) {
+    BatchFn reference = kCurvature ? calculateColinearPointWithCurvatureBatch
+                                   : calculateColinearPointBatch;
+#if COLINEAR_SIMD_X86
+    if (level == SimdLevel::Avx512) {
+        runBlocks(arcBlockAvx512<kCurvature>, 8, reference, x, y, theta, dlead, param, count, outX, outY);
+        return;
+    }
+    if (level == SimdLevel::Avx2) {
+        runBlocks(arcBlockAvx2<kCurvature>, 4, reference, x, y, theta, dlead, param, count, outX, outY);
+        return;
+    }
+#else
+    (void)level;
+#endif
+    reference(x, y, theta, dlead, param, count, outX, outY);
+}
+
+}  // namespace simd_detail
+
+/**
+ * @brief SIMD level used by the *Simd batch functions (detected once)
+ */
+inline SimdLevel activeSimdLevel() {
+    static const SimdLevel level = detectSimdLevel();
+    return level;
+}
+
+/**
+ * @brief Vectorized calculateColinearPointBatch() with runtime CPU dispatch
+ * 
+ * Same inputs, outputs and edge-case handling as the scalar batch
+ * function; see the accuracy notes at the top of this file.
+ * 
+ * @param level  Optional override, e.g. to force a path in benchmarks
+ */
+inline void calculateColinearPointBatchSimd(
+    const double *x,
+    const double *y,
+    const double *theta,
+    const double *dlead,
+    const double *radius,
+    std::size_t count,
+    double *outX,
+    double *outY,
+    SimdLevel level = activeSimdLevel()
+) {
+    COLINEAR_LATENCY_START(start);
+    simd_detail::dispatchBatch<false>(level, x, y, theta, dlead, radius, count, outX, outY);
+    COLINEAR_LATENCY_STOP(SimdBatch, start);
+}
+
+/**
+ * @brief Vectorized calculateColinearPointWithCurvatureBatch()
+ * 
+ * Covers both the arc and the zero-curvature straight-line branch; the
+ * heading sincos is shared between them.
+ * 
+ * @param level  Optional override, e.g. to force a path in benchmarks
+ */
+inline void calculateColinearPointWithCurvatureBatchSimd(
+    const double *x,
+    const double *y,
+    const double *theta,
+    const double *dlead,
+    const double *curvature,
+    std::size_t count,
+    double *outX,
+    double *outY,
+    SimdLevel level = activeSimdLevel()
+) {
+    COLINEAR_LATENCY_START(start);
+    simd_detail::dispatchBatch<true>(level, x, y, theta, dlead, curvature, count, outX, outY);
+    COLINEAR_LATENCY_STOP(SimdCurvatureBatch, start);
+}
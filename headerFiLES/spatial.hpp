@@ -0,0 +1,285 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "geometry.hpp"
+
+// ============================================
+// Nearest-Point Queries on Generated Paths
+// ============================================
+// Two ways to find the part of a path closest to the robot:
+//
+// - PathIndex:      implicit 2-d tree over any set of Points, built once
+//                   per path in O(n log n); nearest and radius queries
+//                   visit O(log n) nodes on path-like data.
+// - projectOntoArc: closed form for a single boomerang arc, using the
+//                   known center and radius (no index at all).
+
+// Returned by PathIndex::nearest() on an empty index
+const std::size_t NO_POINT = static_cast<std::size_t>(-1);
+
+// Subranges this small are scanned linearly instead of split further
+const std::size_t PATH_INDEX_LEAF_SIZE = 16;
+
+/**
+ * @brief Static 2-d tree over a path's points
+ *
+ * The tree is stored implicitly: every subrange [lo, hi) of the permuted
+ * point array has its splitting point in the middle, alternating x and y
+ * by depth, down to PATH_INDEX_LEAF_SIZE points that are scanned directly.
+ * There are no node objects, and rebuilding for a path of the same size
+ * reuses the previous storage. Each subrange keeps its tight bounding box
+ * for pruning.
+ */
+class PathIndex {
+public:
+    PathIndex() = default;
+
+    PathIndex(const Point *points, std::size_t count) {
+        build(points, count);
+    }
+
+    /**
+     * @brief Indexes points[0 .. count); the caller's array is not kept
+     */
+    void build(const Point *points, std::size_t count) {
+        entries_.resize(count);
+        boxes_.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            entries_[i].point = points[i];
+            entries_[i].index = i;
+        }
+        if (count > 0) {
+            buildRange(0, count, 0);
+        }
+    }
+
+    std::size_t size() const { return entries_.size(); }
+    bool empty() const { return entries_.empty(); }
+
+    /**
+     * @brief Index (into the built array) of the point closest to query
+     * @param query      Position to search from
+     * @param distance2  Optional output for the squared distance
+     * @return Index of the nearest point, or NO_POINT if the index is empty
+     */
+    std::size_t nearest(const Point &query, double *distance2 = nullptr) const {
+        std::size_t best = NO_POINT;
+        double bestDistance2 = std::numeric_limits<double>::infinity();
+        nearestRange(0, entries_.size(), 0, query, best, bestDistance2);
+        if (distance2 != nullptr) {
+            *distance2 = bestDistance2;
+        }
+        return best;
+    }
+
+    /**
+     * @brief Calls visit(index, distance2) for every point within radius of query
+     *
+     * Visiting order is unspecified. Nothing is allocated.
+     */
+    template <typename Visitor>
+    void forEachWithin(const Point &query, double radius, Visitor &&visit) const {
+        withinRange(0, entries_.size(), query, radius * radius, visit);
+    }
+
+    /**
+     * @brief Appends the indices of every point within radius of query to out
+     * @return Number of indices appended
+     */
+    std::size_t withinRadius(const Point &query, double radius, std::vector<std::size_t> &out) const {
+        std::size_t before = out.size();
+        forEachWithin(query, radius, [&out](std::size_t index, double) { out.push_back(index); });
+        return out.size() - before;
+    }
+
+private:
+    struct Entry {
+        Point point;
+        std::size_t index;  // Position in the array passed to build()
+    };
+
+    // Tight bounds of every point in a subrange
+    struct Box {
+        double minX;
+        double minY;
+        double maxX;
+        double maxY;
+    };
+
+    static double coordinate(const Point &p, unsigned axis) {
+        return axis == 0 ? p.x : p.y;
+    }
+
+    static double boxDistance2(const Box &box, const Point &p) {
+        double dx = std::max(std::max(box.minX - p.x, p.x - box.maxX), 0.0);
+        double dy = std::max(std::max(box.minY - p.y, p.y - box.maxY), 0.0);
+        return dx * dx + dy * dy;
+    }
+
+    static Box unite(const Box &a, const Box &b) {
+        return Box{std::min(a.minX, b.minX), std::min(a.minY, b.minY),
+                   std::max(a.maxX, b.maxX), std::max(a.maxY, b.maxY)};
+    }
+
+    /**
+     * @brief Splits [lo, hi) at its median and records the subrange bounds
+     * @return Bounds of [lo, hi), stored at the middle entry
+     */
+    Box buildRange(std::size_t lo, std::size_t hi, unsigned axis) {
+        std::size_t mid = lo + (hi - lo) / 2;
+        if (hi - lo <= PATH_INDEX_LEAF_SIZE) {
+            Box box{entries_[lo].point.x, entries_[lo].point.y, entries_[lo].point.x, entries_[lo].point.y};
+            for (std::size_t i = lo + 1; i < hi; ++i) {
+                const Point &p = entries_[i].point;
+                box = unite(box, Box{p.x, p.y, p.x, p.y});
+            }
+            boxes_[mid] = box;
+            return box;
+        }
+        std::nth_element(entries_.begin() + lo, entries_.begin() + mid, entries_.begin() + hi,
+                         [axis](const Entry &a, const Entry &b) {
+                             return coordinate(a.point, axis) < coordinate(b.point, axis);
+                         });
+        const Point &p = entries_[mid].point;
+        Box box{p.x, p.y, p.x, p.y};
+        box = unite(box, buildRange(lo, mid, axis ^ 1u));
+        box = unite(box, buildRange(mid + 1, hi, axis ^ 1u));
+        boxes_[mid] = box;
+        return box;
+    }
+
+    void nearestRange(std::size_t lo, std::size_t hi, unsigned axis, const Point &query,
+                      std::size_t &best, double &bestDistance2) const {
+        if (lo >= hi) {
+            return;
+        }
+        std::size_t mid = lo + (hi - lo) / 2;
+        // Pruning on the subrange bounds (not just the split line) keeps
+        // queries far from the path, where the best distance is large, cheap
+        if (boxDistance2(boxes_[mid], query) >= bestDistance2) {
+            return;
+        }
+        if (hi - lo <= PATH_INDEX_LEAF_SIZE) {
+            for (std::size_t i = lo; i < hi; ++i) {
+                double dx = entries_[i].point.x - query.x;
+                double dy = entries_[i].point.y - query.y;
+                double d2 = dx * dx + dy * dy;
+                if (d2 < bestDistance2) {
+                    bestDistance2 = d2;
+                    best = entries_[i].index;
+                }
+            }
+            return;
+        }
+        const Entry &node = entries_[mid];
+        double dx = node.point.x - query.x;
+        double dy = node.point.y - query.y;
+        double d2 = dx * dx + dy * dy;
+        if (d2 < bestDistance2) {
+            bestDistance2 = d2;
+            best = node.index;
+        }
+
+        // Near side first so the far side is usually pruned
+        if (coordinate(query, axis) < coordinate(node.point, axis)) {
+            nearestRange(lo, mid, axis ^ 1u, query, best, bestDistance2);
+            nearestRange(mid + 1, hi, axis ^ 1u, query, best, bestDistance2);
+        } else {
+            nearestRange(mid + 1, hi, axis ^ 1u, query, best, bestDistance2);
+            nearestRange(lo, mid, axis ^ 1u, query, best, bestDistance2);
+        }
+    }
+
+    template <typename Visitor>
+    void withinRange(std::size_t lo, std::size_t hi, const Point &query, double radius2, Visitor &visit) const {
+        if (lo >= hi) {
+            return;
+        }
+        std::size_t mid = lo + (hi - lo) / 2;
+        if (boxDistance2(boxes_[mid], query) > radius2) {
+            return;
+        }
+        if (hi - lo <= PATH_INDEX_LEAF_SIZE) {
+            for (std::size_t i = lo; i < hi; ++i) {
+                double dx = entries_[i].point.x - query.x;
+                double dy = entries_[i].point.y - query.y;
+                double d2 = dx * dx + dy * dy;
+                if (d2 <= radius2) {
+                    visit(entries_[i].index, d2);
+                }
+            }
+            return;
+        }
+        const Entry &node = entries_[mid];
+        double dx = node.point.x - query.x;
+        double dy = node.point.y - query.y;
+        double d2 = dx * dx + dy * dy;
+        if (d2 <= radius2) {
+            visit(node.index, d2);
+        }
+        withinRange(lo, mid, query, radius2, visit);
+        withinRange(mid + 1, hi, query, radius2, visit);
+    }
+
+    std::vector<Entry> entries_;
+    std::vector<Box> boxes_;  // boxes_[mid] bounds the subrange split at mid
+};
+
+/**
+ * @brief Lookahead distance of the point on a boomerang arc closest to query
+ *
+ * The arc starting at pose with the given radius lies on the circle with
+ * center (x - R sin(theta), y + R cos(theta)); the closest point is where
+ * the ray from the center through query meets it. The result is limited
+ * to the sampled range [dleadMin, dleadMax]: if the ray falls outside it
+ * the nearer end is returned. For a query at the center every point is
+ * equally close and dleadMin is returned.
+ *
+ * @param pose      Start pose with cached heading rotation
+ * @param radius    Curvature radius (same fallback rules as calculateColinearPoint())
+ * @param query     Position to project
+ * @param dleadMin  Smallest lookahead distance on the path
+ * @param dleadMax  Largest lookahead distance on the path
+ * @return double   dlead of the closest point; calculateColinearPoint(pose, dlead, radius) gives the point
+ */
+inline double projectOntoArc(
+    const PoseContext &pose,
+    double radius,
+    const Point &query,
+    double dleadMin,
+    double dleadMax
+) {
+    radius = std::abs(radius) < EPSILON ? DEFAULT_CURVATURE_RADIUS : std::abs(radius);
+    dleadMin = std::max(dleadMin, -MAX_DLEAD);
+    dleadMax = std::min(dleadMax, MAX_DLEAD);
+
+    double centerX = pose.x - radius * pose.sinTheta;
+    double centerY = pose.y + radius * pose.cosTheta;
+    double qx = query.x - centerX;
+    double qy = query.y - centerY;
+    if (qx == 0.0 && qy == 0.0) {
+        return dleadMin;
+    }
+
+    // Arc angle of the query measured from the start point, i.e. the
+    // angle from (sin theta, -cos theta) to (qx, qy), in (-pi, pi]
+    double startX = pose.sinTheta;
+    double startY = -pose.cosTheta;
+    double phi = std::atan2(startX * qy - startY * qx, startX * qx + startY * qy);
+
+    // First revolution of that angle that lands inside the range
+    const double turn = 2.0 * M_PI;
+    double k = std::ceil((dleadMin / radius - phi) / turn);
+    double dlead = radius * (phi + k * turn);
+    if (dlead <= dleadMax) {
+        return dlead < dleadMin ? dleadMin : dlead;
+    }
+
+    // Outside the sampled range: whichever end is closer
+    Point a = calculateColinearPoint(pose, dleadMin, radius);
+    Point b = calculateColinearPoint(pose, dleadMax, radius);
+    double da = (a.x - query.x) * (a.x - query.x) + (a.y - query.y) * (a.y - query.y);
+    double db = (b.x - query.x) * (b.x - query.x) + (b.y - query.y) * (b.y - query.y);
+    return da <= db ? dleadMin : dleadMax;
+}
@@ -0,0 +1,402 @@
+#pragma once
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "angles.hpp"
+#include "geometry.hpp"
+#include "simd.hpp"
+#include "sweep.hpp"
+
+// ============================================
+// Headless Streaming Mode
+// ============================================
+// Non-interactive replacement for the menu loop, for use in pipelines.
+// Reads newline-delimited poses from stdin or a file and writes one
+// "x y" result per input line to stdout. No prompts, no screen clears.
+//
+// Input columns (whitespace or comma separated, '#' starts a comment):
+//   arc        x y theta dlead [radius]   (radius defaults to 1.0)
+//   curvature  x y theta dlead curvature
+//   line       x y theta distance         (collinearCalc straight line)
+
+// Poses parsed before a batch call is made
+const std::size_t STREAM_BATCH_SIZE = 4096;
+
+// Bytes read from the input per fread()
+const std::size_t STREAM_READ_SIZE = 1 << 16;
+
+enum class StreamMode {
+    Arc,
+    Curvature,
+    Line
+};
+
+struct StreamOptions {
+    StreamMode mode = StreamMode::Arc;
+    bool degrees = false;            // theta column is in degrees
+    bool fast = false;               // use the SIMD kernels instead of the scalar reference
+    std::string inputPath;           // empty or "-" = stdin
+    bool binary = false;             // input/output are mapped binary files (binaryio.hpp)
+    std::string outputPath;          // binary result file
+    bool sweep = false;              // evaluate a generated grid instead of reading poses
+    SweepSpec sweepSpec;             // grid for --sweep (theta converted to radians)
+    bool float32 = false;            // --sweep output as float32 instead of float64
+    bool stats = false;              // dump the instrumentation counters to stderr on exit
+    std::string servePath;           // Unix socket to serve requests on (server.hpp)
+    std::string ringName;            // shared-memory pose ring to answer (ring.hpp)
+};
+
+/**
+ * @brief Prints the command line usage to stderr
+ */
+inline void printStreamUsage(const char *program) {
+    std::fprintf(stderr,
+        "Usage: %s [--stream] [--mode arc|curvature|line] [--degrees] [--fast] [--input FILE]\n"
+        "       %s --binary --input POSES --output POINTS [--fast]\n"
+        "       %s --sweep --theta A:S:N --dlead A:S:N --radius A:S:N --output POINTS [--degrees] [--float32]\n"
+        "       %s --serve SOCKET\n"
+        "       %s --ring /NAME\n"
+        "  Without arguments the interactive menu is started.\n"
+        "  --stream        Read poses line by line and print \"x y\" per line\n"
+        "  --mode MODE     arc: x y theta dlead [radius]\n"
+        "                  curvature: x y theta dlead curvature\n"
+        "                  line: x y theta distance\n"
+        "  --degrees       Theta column is in degrees, any magnitude (default radians)\n"
+        "  --fast          Use the SIMD kernels (within a few ULP of the reference)\n"
+        "  --input FILE    Read from FILE instead of stdin\n"
+        "  --binary        Input is a binary pose file, results go to --output\n"
+        "  --output FILE   Binary point file to write (with --binary or --sweep)\n"
+        "  --sweep         Evaluate the grid START + i * STEP, i < COUNT, of every axis\n"
+        "                  (points ordered theta, radius, dlead, dlead fastest)\n"
+        "  --float32       Write --sweep results as float32\n"
+        "  --serve SOCKET  Serve batched binary requests on a Unix socket until SIGINT/SIGTERM,\n"
+        "                  then print request counts and p50/p99 latency to stderr\n"
+        "  --ring /NAME    Create the shared-memory pose ring NAME and busy-poll it\n"
+        "                  until SIGINT/SIGTERM (uses one core)\n"
+        "  --stats         Print curve branch counters to stderr when done\n"
+        "                  (needs a build with COLINEAR_INSTRUMENT)\n",
+        program, program, program, program, program);
+}
+
+/**
+ * @brief Parses headless-mode flags
+ * @return false (with error set) on an unknown flag or missing value
+ */
+inline bool parseStreamArgs(int argc, char **argv, StreamOptions &options, std::string &error) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--stream") {
+            continue;
+        } else if (arg == "--degrees") {
+            options.degrees = true;
+        } else if (arg == "--fast") {
+            options.fast = true;
+        } else if (arg == "--binary") {
+            options.binary = true;
+        } else if (arg == "--sweep") {
+            options.sweep = true;
+        } else if (arg == "--float32") {
+            options.float32 = true;
+        } else if (arg == "--stats") {
+            options.stats = true;
+        } else if (arg == "--theta" || arg == "--dlead" || arg == "--radius") {
+            if (i + 1 >= argc) {
+                error = "missing value for " + arg;
+                return false;
+            }
+            SweepAxis &axis = arg == "--theta" ? options.sweepSpec.theta
+                            : arg == "--dlead" ? options.sweepSpec.dlead
+                            : options.sweepSpec.radius;
+            if (!parseSweepAxis(argv[++i], axis)) {
+                error = "bad value for " + arg + " (expected START:STEP:COUNT)";
+                return false;
+            }
+        } else if (arg == "--mode" || arg == "--input" || arg == "--output" || arg == "--serve" || arg == "--ring") {
+            if (i + 1 >= argc) {
+                error = "missing value for " + arg;
+                return false;
+            }
+            std::string value = argv[++i];
+            if (arg == "--input") {
+                options.inputPath = value;
+            } else if (arg == "--serve") {
+                options.servePath = value;
+            } else if (arg == "--ring") {
+                options.ringName = value;
+            } else if (arg == "--output") {
+                options.outputPath = value;
+            } else if (value == "arc") {
+                options.mode = StreamMode::Arc;
+            } else if (value == "curvature") {
+                options.mode = StreamMode::Curvature;
+            } else if (value == "line") {
+                options.mode = StreamMode::Line;
+            } else {
+                error = "unknown mode '" + value + "'";
+                return false;
+            }
+        } else {
+            error = "unknown option '" + arg + "'";
+            return false;
+        }
+    }
+    if (options.binary && (options.inputPath.empty() || options.inputPath == "-" || options.outputPath.empty())) {
+        error = "--binary needs --input FILE and --output FILE";
+        return false;
+    }
+    if (options.binary && options.inputPath == options.outputPath) {
+        error = "--binary needs different --input and --output files";
+        return false;
+    }
+    if (options.sweep && (options.binary || options.outputPath.empty())) {
+        error = "--sweep needs --output FILE and cannot be combined with --binary";
+        return false;
+    }
+    std::uint64_t sweepPoints = 0;
+    if (options.sweep && !sweepPointCount(options.sweepSpec, sweepPoints)) {
+        error = "--sweep grid has too many points (theta x dlead x radius counts overflow)";
+        return false;
+    }
+    if (!options.binary && !options.sweep && !options.outputPath.empty()) {
+        error = "--output is only supported with --binary or --sweep";
+        return false;
+    }
+    bool service = !options.servePath.empty() || !options.ringName.empty();
+    if (service && (options.binary || options.sweep || !options.inputPath.empty() ||
+                    (!options.servePath.empty() && !options.ringName.empty()))) {
+        error = "--serve and --ring cannot be combined with each other, --binary, --sweep or --input";
+        return false;
+    }
+    if (options.sweep && options.degrees) {
+        options.sweepSpec.theta.start = degreesToRadians(options.sweepSpec.theta.start);
+        options.sweepSpec.theta.step = degreesToRadians(options.sweepSpec.theta.step);
+    }
+    return true;
+}
+
+namespace stream_detail {
+
+/**
+ * @brief Column buffers for one batch of parsed poses
+ */
+struct PoseBatch {
+    std::vector<double> x, y, theta, dlead, param, outX, outY;
+    std::size_t size = 0;
+
+    PoseBatch() {
+        for (std::vector<double> *column : {&x, &y, &theta, &dlead, &param, &outX, &outY}) {
+            column->resize(STREAM_BATCH_SIZE);
+        }
+    }
+};
+
+inline bool isSeparator(char c) {
+    return c == ' ' || c == '\t' || c == ',' || c == '\r';
+}
+
+/**
+ * @brief Parses up to maxFields doubles from one line
+ * @return Number of fields parsed, or -1 on a malformed number
+ */
+inline int parseFields(const char *begin, const char *end, double *fields, int maxFields) {
+    int count = 0;
+    const char *p = begin;
+    for (;;) {
+        while (p < end && isSeparator(*p)) {
+            ++p;
+        }
+        if (p == end || *p == '#') {
+            return count;
+        }
+        if (count == maxFields) {
+            return -1;
+        }
+        // from_chars does not accept a leading '+'
+        if (*p == '+') {
+            ++p;
+        }
+        std::from_chars_result parsed = std::from_chars(p, end, fields[count]);
+        if (parsed.ec != std::errc() || (parsed.ptr < end && !isSeparator(*parsed.ptr) && *parsed.ptr != '#')) {
+            return -1;
+        }
+        p = parsed.ptr;
+        ++count;
+    }
+}
+
+/**
+ * @brief Buffered stdout writer using to_chars (shortest round-trip form)
+ */
+class OutputBuffer {
+public:
+    explicit OutputBuffer(std::FILE *file) : file_(file) {
+        buffer_.resize(STREAM_READ_SIZE);
+    }
+
+    ~OutputBuffer() {
+        flush();
+    }
+
+    void writePair(double a, double b) {
+        // Two doubles in shortest form need at most 2 * 24 + 2 characters
+        if (buffer_.size() - used_ < 64) {
+            flush();
+        }
+        char *p = buffer_.data() + used_;
+        char *end = buffer_.data() + buffer_.size();
+        p = std::to_chars(p, end, a).ptr;
+        *p++ = ' ';
+        p = std::to_chars(p, end, b).ptr;
+        *p++ = '\n';
+        used_ = static_cast<std::size_t>(p - buffer_.data());
+    }
+
+    void flush() {
+        if (used_ > 0) {
+            std::fwrite(buffer_.data(), 1, used_, file_);
+            used_ = 0;
+        }
+    }
+
+private:
+    std::FILE *file_;
+    std::vector<char> buffer_;
+    std::size_t used_ = 0;
+};
+
+inline void evaluateBatch(const StreamOptions &options, PoseBatch &batch) {
+    if (options.mode == StreamMode::Arc) {
+        if (options.fast) {
+            calculateColinearPointBatchSimd(batch.x.data(), batch.y.data(), batch.theta.data(),
+                batch.dlead.data(), batch.param.data(), batch.size, batch.outX.data(), batch.outY.data());
+        } else {
+            calculateColinearPointBatch(batch.x.data(), batch.y.data(), batch.theta.data(),
+                batch.dlead.data(), batch.param.data(), batch.size, batch.outX.data(), batch.outY.data());
+        }
+    } else {
+        // Line mode is the zero-curvature branch (param column is 0)
+        if (options.fast) {
+            calculateColinearPointWithCurvatureBatchSimd(batch.x.data(), batch.y.data(), batch.theta.data(),
+                batch.dlead.data(), batch.param.data(), batch.size, batch.outX.data(), batch.outY.data());
+        } else {
+            calculateColinearPointWithCurvatureBatch(batch.x.data(), batch.y.data(), batch.theta.data(),
+                batch.dlead.data(), batch.param.data(), batch.size, batch.outX.data(), batch.outY.data());
+        }
+    }
+}
+
+}  // namespace stream_detail
+
+/**
+ * @brief Runs the headless streaming calculator
+ *
+ * Blank and comment-only lines are skipped. Malformed lines are reported
+ * on stderr with their line number and produce no output.
+ *
+ * @return 0 on success, 1 if the input could not be read or any line was malformed
+ */
+inline int runStream(const StreamOptions &options) {
+    std::FILE *in = stdin;
+    if (!options.inputPath.empty() && options.inputPath != "-") {
+        in = std::fopen(options.inputPath.c_str(), "rb");
+        if (in == nullptr) {
+            std::fprintf(stderr, "error: cannot open '%s'\n", options.inputPath.c_str());
+            return 1;
+        }
+    }
+
+    int minFields = 4;
+    int maxFields = 4;
+    if (options.mode == StreamMode::Arc) {
+        maxFields = 5;
+    } else if (options.mode == StreamMode::Curvature) {
+        minFields = 5;
+        maxFields = 5;
+    }
+
+    stream_detail::PoseBatch batch;
+    stream_detail::OutputBuffer out(stdout);
+    std::vector<char> buffer(STREAM_READ_SIZE);
+    std::size_t carried = 0;
+    std::size_t lineNumber = 0;
+    bool failed = false;
+
+    auto flushBatch = [&] {
+        stream_detail::evaluateBatch(options, batch);
+        for (std::size_t i = 0; i < batch.size; ++i) {
+            out.writePair(batch.outX[i], batch.outY[i]);
+        }
+        batch.size = 0;
+    };
+
+    auto handleLine = [&](const char *begin, const char *end) {
+        ++lineNumber;
+        double fields[5];
+        int count = stream_detail::parseFields(begin, end, fields, maxFields);
+        if (count == 0) {
+            return;
+        }
+        if (count < 0) {
+            std::fprintf(stderr, "error: line %zu: malformed number or too many columns\n", lineNumber);
+            failed = true;
+            return;
+        }
+        if (count < minFields) {
+            std::fprintf(stderr, "error: line %zu: expected %d to %d numbers\n", lineNumber, minFields, maxFields);
+            failed = true;
+            return;
+        }
+        std::size_t i = batch.size++;
+        batch.x[i] = fields[0];
+        batch.y[i] = fields[1];
+        batch.theta[i] = options.degrees ? wrappedDegreesToRadians(fields[2]) : fields[2];
+        batch.dlead[i] = fields[3];
+        if (options.mode == StreamMode::Line) {
+            batch.param[i] = 0.0;
+        } else {
+            batch.param[i] = count == 5 ? fields[4] : DEFAULT_CURVATURE_RADIUS;
+        }
+        if (batch.size == STREAM_BATCH_SIZE) {
+            flushBatch();
+        }
+    };
+
+    for (;;) {
+        // Grow the buffer if a single line is longer than what is left
+        if (carried == buffer.size()) {
+            buffer.resize(buffer.size() * 2);
+        }
+        std::size_t got = std::fread(buffer.data() + carried, 1, buffer.size() - carried, in);
+        std::size_t filled = carried + got;
+        const char *p = buffer.data();
+        const char *end = buffer.data() + filled;
+        while (const char *nl = static_cast<const char *>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)))) {
+            handleLine(p, nl);
+            p = nl + 1;
+        }
+        carried = static_cast<std::size_t>(end - p);
+        if (got == 0) {
+            if (carried > 0) {
+                handleLine(p, end);  // Last line without a trailing newline
+            }
+            break;
+        }
+        std::memmove(buffer.data(), p, carried);
+    }
+
+    if (std::ferror(in)) {
+        std::fprintf(stderr, "error: read failed\n");
+        failed = true;
+    }
+    if (in != stdin) {
+        std::fclose(in);
+    }
+    if (batch.size > 0) {
+        flushBatch();
+    }
+    out.flush();
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,240 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include "geometry.hpp"
+#include "parallel.hpp"
+
+// ============================================
+// Parameter Sweep Engine
+// ============================================
+// Evaluates the full theta x radius x dlead grid from a single start
+// position without any per-point input. The grid is separable:
+//
+// - the local-frame arc point (R sin(phi), R (1 - cos(phi))) depends only
+//   on dlead and radius. Along a dlead run phi grows by the constant
+//   dleadStep / R, so it is advanced with the rotation recurrence (and
+//   resynchronized every SAMPLE_RESYNC_INTERVAL points) instead of a
+//   sincos per point;
+// - the heading rotation depends only on theta, so every theta reuses the
+//   same local run and costs one sincos per run plus a rotate-and-
+//   translate per point.
+//
+// Points are stored row-major with dlead fastest:
+//
+//   index = (thetaIndex * radius.count + radiusIndex) * dlead.count + dleadIndex
+//
+// Work items are (theta block, radius, dlead segment) tiles. The tiling
+// depends only on the spec, so results are identical for any thread count.
+
+// dleads per tile (two 32 KB local-frame columns and the stay flags on the stack)
+const std::size_t SWEEP_SEGMENT_SIZE = 4096;
+
+// thetas per tile; the local run is rebuilt once per block
+const std::size_t SWEEP_THETA_BLOCK = 64;
+
+/**
+ * @brief One swept parameter: start + i * step for i in [0, count)
+ */
+struct SweepAxis {
+    double start = 0.0;
+    double step = 0.0;
+    std::size_t count = 1;
+
+    double value(std::size_t i) const { return start + static_cast<double>(i) * step; }
+};
+
+/**
+ * @brief Grid definition; theta is in radians
+ */
+struct SweepSpec {
+    double x = 0.0;  // Start position shared by every grid point
+    double y = 0.0;
+    SweepAxis theta;
+    SweepAxis dlead;
+    SweepAxis radius;
+};
+
+/**
+ * @brief Number of grid points, theta.count * radius.count * dlead.count
+ *
+ * Axis counts come from the command line, so the product is checked: a
+ * wrapped count would size the output for a handful of points and then
+ * evaluate far more.
+ *
+ * @return false (count unchanged) if the product does not fit in size_t
+ */
+inline bool sweepPointCount(const SweepSpec &spec, std::uint64_t &count) {
+    const std::uint64_t limit = std::numeric_limits<std::size_t>::max();
+    std::uint64_t product = 1;
+    for (std::uint64_t axis : {std::uint64_t(spec.theta.count), std::uint64_t(spec.radius.count),
+                               std::uint64_t(spec.dlead.count)}) {
+        if (axis != 0 && product > limit / axis) {
+            return false;
+        }
+        product *= axis;
+    }
+    count = product;
+    return true;
+}
+
+/**
+ * @brief Parses "START:STEP:COUNT" into an axis
+ * @return false on a malformed value or a zero count
+ */
+inline bool parseSweepAxis(const std::string &text, SweepAxis &axis) {
+    const char *p = text.c_str();
+    char *end = nullptr;
+    axis.start = std::strtod(p, &end);
+    if (end == p || *end != ':') {
+        return false;
+    }
+    p = end + 1;
+    axis.step = std::strtod(p, &end);
+    if (end == p || *end != ':') {
+        return false;
+    }
+    p = end + 1;
+    if (*p == '-') {
+        return false;
+    }
+    unsigned long long count = std::strtoull(p, &end, 10);
+    if (end == p || *end != '\0' || count == 0) {
+        return false;
+    }
+    axis.count = static_cast<std::size_t>(count);
+    return true;
+}
+
+namespace sweep_detail {
+
+/**
+ * @brief Local-frame arc points for count dleads of an axis, starting at index first
+ *
+ * Same MIN_DLEAD / MAX_DLEAD / radius rules as basicColinearPoint(), so
+ * rotating and translating the result reproduces calculateColinearPoint()
+ * to a few ULP (the recurrence error of sampleColinearPointsUniform()).
+ * stay[i] marks the |dlead| < MIN_DLEAD rows, which return the start
+ * pose untouched.
+ */
+inline void localArcRun(const SweepAxis &dleads, std::size_t first, std::size_t count, double radius,
+                        double *localX, double *localY, bool *stay) {
+    if (std::abs(radius) < EPSILON) {
+        radius = DEFAULT_CURVATURE_RADIUS;
+    }
+    radius = std::abs(radius);
+
+    double sinStep;
+    double cosStep;
+    curveSinCos(dleads.step / radius, sinStep, cosStep);
+
+    double sinPhi = 0.0;
+    double cosPhi = 1.0;
+    std::size_t sinceSync = SAMPLE_RESYNC_INTERVAL;  // Forces a sync on the first point
+    for (std::size_t i = 0; i < count; ++i) {
+        double dlead = dleads.value(first + i);
+        stay[i] = std::abs(dlead) < MIN_DLEAD;
+        if (stay[i]) {
+            localX[i] = 0.0;
+            localY[i] = 0.0;
+            sinceSync = SAMPLE_RESYNC_INTERVAL;
+            continue;
+        }
+        if (std::abs(dlead) > MAX_DLEAD) {
+            double sinClamped;
+            double cosClamped;
+            curveSinCos((dlead > 0.0 ? MAX_DLEAD : -MAX_DLEAD) / radius, sinClamped, cosClamped);
+            localX[i] = radius * sinClamped;
+            localY[i] = radius * (1.0 - cosClamped);
+            sinceSync = SAMPLE_RESYNC_INTERVAL;
+            continue;
+        }
+
+        if (sinceSync >= SAMPLE_RESYNC_INTERVAL) {
+            curveSinCos(dlead / radius, sinPhi, cosPhi);
+            sinceSync = 0;
+        } else {
+            double nextSin = sinPhi * cosStep + cosPhi * sinStep;
+            double nextCos = cosPhi * cosStep - sinPhi * sinStep;
+            sinPhi = nextSin;
+            cosPhi = nextCos;
+        }
+        ++sinceSync;
+        localX[i] = radius * sinPhi;
+        localY[i] = radius * (1.0 - cosPhi);
+    }
+}
+
+/**
+ * @brief Evaluates tile `item` into outX / outY (indexed like the full grid)
+ */
+template <typename T>
+inline void evaluateTile(const SweepSpec &spec, std::size_t item, T *outX, T *outY) {
+    std::size_t segments = (spec.dlead.count + SWEEP_SEGMENT_SIZE - 1) / SWEEP_SEGMENT_SIZE;
+    std::size_t segment = item % segments;
+    std::size_t radiusIndex = (item / segments) % spec.radius.count;
+    std::size_t thetaBlock = item / segments / spec.radius.count;
+
+    std::size_t dleadBegin = segment * SWEEP_SEGMENT_SIZE;
+    std::size_t n = spec.dlead.count - dleadBegin < SWEEP_SEGMENT_SIZE ? spec.dlead.count - dleadBegin
+                                                                      : SWEEP_SEGMENT_SIZE;
+    double localX[SWEEP_SEGMENT_SIZE];
+    double localY[SWEEP_SEGMENT_SIZE];
+    bool stay[SWEEP_SEGMENT_SIZE];
+    localArcRun(spec.dlead, dleadBegin, n, spec.radius.value(radiusIndex), localX, localY, stay);
+
+    std::size_t thetaBegin = thetaBlock * SWEEP_THETA_BLOCK;
+    std::size_t thetaEnd = spec.theta.count - thetaBegin < SWEEP_THETA_BLOCK ? spec.theta.count
+                                                                            : thetaBegin + SWEEP_THETA_BLOCK;
+    for (std::size_t t = thetaBegin; t < thetaEnd; ++t) {
+        PoseContext pose = makePoseContext(spec.x, spec.y, spec.theta.value(t));
+        std::size_t base = (t * spec.radius.count + radiusIndex) * spec.dlead.count + dleadBegin;
+        T *rowX = outX + base;
+        T *rowY = outY + base;
+        // Same early return, rotation, translation and EPSILON cleanup as
+        // calculateColinearPoint()
+        for (std::size_t i = 0; i < n; ++i) {
+            double x = pose.x + localX[i] * pose.cosTheta - localY[i] * pose.sinTheta;
+            double y = pose.y + localX[i] * pose.sinTheta + localY[i] * pose.cosTheta;
+            x = std::abs(x) < EPSILON ? 0.0 : x;
+            y = std::abs(y) < EPSILON ? 0.0 : y;
+            rowX[i] = static_cast<T>(stay[i] ? pose.x : x);
+            rowY[i] = static_cast<T>(stay[i] ? pose.y : y);
+        }
+    }
+}
+
+}  // namespace sweep_detail
+
+/**
+ * @brief Evaluates the whole grid into caller-owned columns of sweepPointCount() values
+ *
+ * Works for double and float outputs (float is narrowed from the double
+ * result). With a pool the tiles run on its workers; without one they
+ * run on the calling thread. The output is the same either way. A spec
+ * whose point count overflows (sweepPointCount() false) writes nothing.
+ *
+ * @param pool  Thread pool, or nullptr for a serial sweep
+ */
+template <typename T>
+inline void evaluateSweep(WorkStealingPool *pool, const SweepSpec &spec, T *outX, T *outY) {
+    std::uint64_t count = 0;
+    if (!sweepPointCount(spec, count) || count == 0) {
+        return;
+    }
+    std::size_t segments = (spec.dlead.count + SWEEP_SEGMENT_SIZE - 1) / SWEEP_SEGMENT_SIZE;
+    std::size_t thetaBlocks = (spec.theta.count + SWEEP_THETA_BLOCK - 1) / SWEEP_THETA_BLOCK;
+    std::size_t items = thetaBlocks * spec.radius.count * segments;
+    if (pool == nullptr) {
+        for (std::size_t item = 0; item < items; ++item) {
+            sweep_detail::evaluateTile(spec, item, outX, outY);
+        }
+        return;
+    }
+    pool->parallelFor(items, [&](std::size_t item) {
+        sweep_detail::evaluateTile(spec, item, outX, outY);
+    });
+}
@@ -0,0 +1,224 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "geometry.hpp"
+
+// ============================================
+// Allocation-Free Path Generation
+// ============================================
+// Whole boomerang paths written into storage the caller owns, so a
+// replanning loop never touches the heap:
+//
+// - PathArena:   bump allocator over a caller-supplied buffer. reset() at
+//                the start of each replan and the same memory is reused.
+// - PointRing:   fixed-capacity ring of the most recent path points,
+//                storage inline in the object.
+//
+// Neither allocates, throws or locks; running out of space is reported
+// through the return value.
+
+/**
+ * @brief Contiguous run of path points inside an arena or other buffer
+ */
+struct PathView {
+    Point *points = nullptr;
+    std::size_t count = 0;
+
+    bool empty() const { return count == 0; }
+    Point &operator[](std::size_t i) const { return points[i]; }
+    Point *begin() const { return points; }
+    Point *end() const { return points + count; }
+};
+
+/**
+ * @brief Bump allocator over a caller-owned byte buffer
+ *
+ * allocate() hands out aligned slices in order; there is no per-slice
+ * free, the whole arena is recycled with reset(). The arena never owns
+ * the memory, so it can sit on a static buffer, the stack or a region
+ * reserved once at startup.
+ */
+class PathArena {
+public:
+    PathArena(void *buffer, std::size_t capacityBytes)
+        : base_(static_cast<unsigned char *>(buffer)), capacity_(capacityBytes) {}
+
+    PathArena(const PathArena &) = delete;
+    PathArena &operator=(const PathArena &) = delete;
+
+    /**
+     * @brief Reserves bytes with the given power-of-two alignment
+     * @return Pointer to the slice, or nullptr if the arena is full
+     */
+    void *allocate(std::size_t bytes, std::size_t alignment) {
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(base_) + used_;
+        std::size_t padding = static_cast<std::size_t>((alignment - address % alignment) % alignment);
+        if (padding > capacity_ - used_ || bytes > capacity_ - used_ - padding) {
+            return nullptr;
+        }
+        void *slice = base_ + used_ + padding;
+        used_ += padding + bytes;
+        if (used_ > highWater_) {
+            highWater_ = used_;
+        }
+        return slice;
+    }
+
+    /**
+     * @brief Reserves room for count points
+     * @return First point, or nullptr if the arena is full
+     */
+    Point *allocatePoints(std::size_t count) {
+        if (count > capacity_ / sizeof(Point)) {
+            return nullptr;
+        }
+        return static_cast<Point *>(allocate(count * sizeof(Point), alignof(Point)));
+    }
+
+    /**
+     * @brief Releases every slice at once; the memory is reused by the next allocations
+     */
+    void reset() { used_ = 0; }
+
+    std::size_t used() const { return used_; }
+    std::size_t capacity() const { return capacity_; }
+    std::size_t remaining() const { return capacity_ - used_; }
+    std::size_t highWater() const { return highWater_; }  // Peak used() since construction
+
+private:
+    unsigned char *base_;
+    std::size_t capacity_;
+    std::size_t used_ = 0;
+    std::size_t highWater_ = 0;
+};
+
+/**
+ * @brief Fixed-capacity ring of path points with inline storage
+ *
+ * push() overwrites the oldest point once the ring is full. Index 0 is
+ * the oldest point still held.
+ */
+template <std::size_t Capacity>
+class PointRing {
+public:
+    static_assert(Capacity > 0, "PointRing needs a non-zero capacity");
+
+    void push(const Point &p) {
+        points_[(head_ + count_) % Capacity] = p;
+        if (count_ < Capacity) {
+            ++count_;
+        } else {
+            head_ = (head_ + 1) % Capacity;
+        }
+    }
+
+    const Point &operator[](std::size_t i) const { return points_[(head_ + i) % Capacity]; }
+    const Point &front() const { return (*this)[0]; }
+    const Point &back() const { return (*this)[count_ - 1]; }
+
+    void clear() {
+        head_ = 0;
+        count_ = 0;
+    }
+
+    std::size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    bool full() const { return count_ == Capacity; }
+    static constexpr std::size_t capacity() { return Capacity; }
+
+    /**
+     * @brief Reserves the next count slots as at most two contiguous runs
+     *
+     * The slots become part of the ring (evicting the oldest points if
+     * needed) and are meant to be filled by the caller right away, e.g.
+     * by a sampling function. count must not exceed Capacity.
+     */
+    void reserveBack(std::size_t count, PathView &first, PathView &second) {
+        std::size_t tail = (head_ + count_) % Capacity;
+        std::size_t firstCount = count < Capacity - tail ? count : Capacity - tail;
+        first.points = &points_[tail];
+        first.count = firstCount;
+        second.points = &points_[0];
+        second.count = count - firstCount;
+
+        std::size_t total = count_ + count;
+        if (total > Capacity) {
+            head_ = (head_ + total - Capacity) % Capacity;
+            count_ = Capacity;
+        } else {
+            count_ = total;
+        }
+    }
+
+private:
+    Point points_[Capacity];
+    std::size_t head_ = 0;
+    std::size_t count_ = 0;
+};
+
+/**
+ * @brief Samples a whole path into arena memory
+ *
+ * Points are the same as sampleColinearPointsUniform(pose, dleadStart,
+ * dleadStep, count, radius, ...). Call arena.reset() before replanning to
+ * reuse the storage of the previous path.
+ *
+ * @param arena       Arena to take the point storage from
+ * @param pose        Pose with cached heading rotation
+ * @param dleadStart  Lookahead distance of the first point
+ * @param dleadStep   Lookahead increment between points
+ * @param count       Number of points
+ * @param radius      Curvature radius
+ * @return PathView   The path, or an empty view if the arena is too small
+ */
+inline PathView generatePath(
+    PathArena &arena,
+    const PoseContext &pose,
+    double dleadStart,
+    double dleadStep,
+    std::size_t count,
+    double radius = DEFAULT_CURVATURE_RADIUS
+) {
+    PathView path;
+    Point *storage = arena.allocatePoints(count);
+    if (storage == nullptr) {
+        return path;
+    }
+    sampleColinearPointsUniform(pose, dleadStart, dleadStep, count, radius, storage);
+    path.points = storage;
+    path.count = count;
+    return path;
+}
+
+/**
+ * @brief Appends a sampled path to a ring, evicting the oldest points
+ *
+ * If count exceeds the ring capacity only the last Capacity points are
+ * sampled. Across the wrap point the sampling restarts at that point's
+ * dlead, which can differ from dleadStart + i * dleadStep by rounding.
+ *
+ * @return Number of points written
+ */
+template <std::size_t Capacity>
+inline std::size_t appendPath(
+    PointRing<Capacity> &ring,
+    const PoseContext &pose,
+    double dleadStart,
+    double dleadStep,
+    std::size_t count,
+    double radius = DEFAULT_CURVATURE_RADIUS
+) {
+    if (count > Capacity) {
+        dleadStart += static_cast<double>(count - Capacity) * dleadStep;
+        count = Capacity;
+    }
+    PathView first;
+    PathView second;
+    ring.reserveBack(count, first, second);
+    sampleColinearPointsUniform(pose, dleadStart, dleadStep, first.count, radius, first.points);
+    if (!second.empty()) {
+        double secondStart = dleadStart + static_cast<double>(first.count) * dleadStep;
+        sampleColinearPointsUniform(pose, secondStart, dleadStep, second.count, radius, second.points);
+    }
+    return count;
+}
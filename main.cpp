@@ -2,7 +2,31 @@
 #include <string>
 #include <cstdlib> 
 #include "headerFiLES/functions.hpp"
-int main(){
+#include "headerFiLES/stream.hpp"
+#include "headerFiLES/binaryio.hpp"
+#include "headerFiLES/server.hpp"
+#include "headerFiLES/ring.hpp"
+int main(int argc, char **argv){
+
+    // Any command-line flag selects the headless streaming mode
+    if (argc > 1) {
+        StreamOptions options;
+        std::string error;
+        if (!parseStreamArgs(argc, argv, options, error)) {
+            std::fprintf(stderr, "error: %s\n", error.c_str());
+            printStreamUsage(argv[0]);
+            return 2;
+        }
+        int status = !options.servePath.empty() ? runServer(options)
+                   : !options.ringName.empty() ? runRing(options)
+                   : options.sweep ? runSweep(options)
+                   : options.binary ? runBinary(options)
+                   : runStream(options);
+        if (options.stats) {
+            dumpCurveCounters(stderr);
+        }
+        return status;
+    }
 
     int choice;
     std::string title = "Main Screen";
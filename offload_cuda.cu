@@ -0,0 +1,224 @@
+// ============================================
+// CUDA Offload Backend
+// ============================================
+// Device side of BatchOffloader (headerFiLES/offload.hpp). Built only with
+// the CMake option COLINEAR_CUDA.
+//
+// A batch is cut into chunks that alternate between two slots, each with
+// its own stream, pinned host staging buffer and device buffer. While the
+// GPU copies and computes one slot, the host stages the next chunk into
+// the other and unpacks the previous results, so PCIe transfers, kernel
+// time and host copies overlap.
+#include <cstring>
+#include <cuda_runtime.h>
+#include "headerFiLES/geometry.hpp"
+#include "headerFiLES/offload_device.hpp"
+
+namespace {
+
+// Inputs and outputs per point in one staging buffer (5 in, 2 out)
+const std::size_t STAGED_COLUMNS = 7;
+const int OFFLOAD_THREADS_PER_BLOCK = 256;
+
+/**
+ * @brief Device copy of basicColinearPoint<double>()
+ */
+__device__ inline void deviceArcPoint(double x, double y, double theta, double dlead, double radius,
+                                      double &outX, double &outY) {
+    if (fabs(dlead) < MIN_DLEAD) {
+        outX = x;
+        outY = y;
+        return;
+    }
+    dlead = fmin(fmax(dlead, -MAX_DLEAD), MAX_DLEAD);
+    if (fabs(radius) < EPSILON) {
+        radius = DEFAULT_CURVATURE_RADIUS;
+    }
+    radius = fabs(radius);
+
+    double sinPhi;
+    double cosPhi;
+    sincos(dlead / radius, &sinPhi, &cosPhi);
+    double localX = radius * sinPhi;
+    double localY = radius * (1.0 - cosPhi);
+
+    double sinTheta;
+    double cosTheta;
+    sincos(theta, &sinTheta, &cosTheta);
+    double rx = x + localX * cosTheta - localY * sinTheta;
+    double ry = y + localX * sinTheta + localY * cosTheta;
+    outX = fabs(rx) < EPSILON ? 0.0 : rx;
+    outY = fabs(ry) < EPSILON ? 0.0 : ry;
+}
+
+/**
+ * @brief One point per thread; shape is radius or curvature
+ */
+template <bool kCurvature>
+__global__ void colinearPointKernel(const double *x, const double *y, const double *theta, const double *dlead,
+                                    const double *shape, std::size_t count, double *outX, double *outY) {
+    std::size_t i = static_cast<std::size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (i >= count) {
+        return;
+    }
+    double d = dlead[i];
+    double radius = shape[i];
+    if (kCurvature) {
+        double curvature = radius;
+        if (fabs(curvature) < EPSILON) {
+            // Straight line, same as basicColinearPointWithCurvature()
+            double sinTheta;
+            double cosTheta;
+            sincos(theta[i], &sinTheta, &cosTheta);
+            outX[i] = x[i] + d * cosTheta;
+            outY[i] = y[i] + d * sinTheta;
+            return;
+        }
+        radius = 1.0 / fabs(curvature);
+        d = curvature < 0.0 ? -d : d;
+    }
+    deviceArcPoint(x[i], y[i], theta[i], d, radius, outX[i], outY[i]);
+}
+
+}  // namespace
+
+namespace cuda_offload {
+
+struct Slot {
+    cudaStream_t stream = nullptr;
+    double *host = nullptr;    // Pinned, STAGED_COLUMNS * chunk doubles
+    double *device = nullptr;  // Same layout on the device
+    std::size_t begin = 0;     // Batch offset of the chunk in flight
+    std::size_t count = 0;     // 0 = slot idle
+};
+
+struct Context {
+    std::size_t chunkPoints = 0;
+    Slot slots[2];
+    char name[256] = {};
+};
+
+Context *createContext(std::size_t chunkPoints) {
+    int devices = 0;
+    if (cudaGetDeviceCount(&devices) != cudaSuccess || devices == 0 || cudaSetDevice(0) != cudaSuccess) {
+        return nullptr;
+    }
+    Context *context = new Context;
+    context->chunkPoints = chunkPoints == 0 ? OFFLOAD_CHUNK_POINTS : chunkPoints;
+    cudaDeviceProp properties;
+    if (cudaGetDeviceProperties(&properties, 0) == cudaSuccess) {
+        std::strncpy(context->name, properties.name, sizeof(context->name) - 1);
+    }
+    std::size_t bytes = STAGED_COLUMNS * context->chunkPoints * sizeof(double);
+    for (Slot &slot : context->slots) {
+        if (cudaStreamCreateWithFlags(&slot.stream, cudaStreamNonBlocking) != cudaSuccess
+            || cudaHostAlloc(reinterpret_cast<void **>(&slot.host), bytes, cudaHostAllocDefault) != cudaSuccess
+            || cudaMalloc(reinterpret_cast<void **>(&slot.device), bytes) != cudaSuccess) {
+            destroyContext(context);
+            return nullptr;
+        }
+    }
+    return context;
+}
+
+void destroyContext(Context *context) {
+    if (context == nullptr) {
+        return;
+    }
+    for (Slot &slot : context->slots) {
+        if (slot.stream != nullptr) {
+            cudaStreamSynchronize(slot.stream);
+            cudaStreamDestroy(slot.stream);
+        }
+        if (slot.host != nullptr) {
+            cudaFreeHost(slot.host);
+        }
+        if (slot.device != nullptr) {
+            cudaFree(slot.device);
+        }
+    }
+    delete context;
+}
+
+const char *deviceName(const Context *context) {
+    return context->name[0] != '\0' ? context->name : "cuda";
+}
+
+namespace {
+
+/**
+ * @brief Waits for the slot's chunk and copies its results to the caller
+ */
+bool finishSlot(Context *context, Slot &slot, double *outX, double *outY) {
+    if (slot.count == 0) {
+        return true;
+    }
+    if (cudaStreamSynchronize(slot.stream) != cudaSuccess) {
+        return false;
+    }
+    const double *results = slot.host + 5 * context->chunkPoints;
+    std::memcpy(outX + slot.begin, results, slot.count * sizeof(double));
+    std::memcpy(outY + slot.begin, results + context->chunkPoints, slot.count * sizeof(double));
+    slot.count = 0;
+    return true;
+}
+
+}  // namespace
+
+bool runBatch(Context *context, bool curvature, const double *x, const double *y, const double *theta,
+              const double *dlead, const double *shape, std::size_t count, double *outX, double *outY) {
+    const std::size_t chunk = context->chunkPoints;
+    const double *inputs[5] = {x, y, theta, dlead, shape};
+    bool ok = true;
+    std::size_t next = 0;
+    for (std::size_t begin = 0; begin < count && ok; begin += chunk, next ^= 1) {
+        Slot &slot = context->slots[next];
+        ok = finishSlot(context, slot, outX, outY);
+        if (!ok) {
+            break;
+        }
+
+        std::size_t n = count - begin < chunk ? count - begin : chunk;
+        for (std::size_t column = 0; column < 5; ++column) {
+            std::memcpy(slot.host + column * chunk, inputs[column] + begin, n * sizeof(double));
+        }
+        // Columns keep a stride of chunk, so copy each one separately
+        for (std::size_t column = 0; column < 5 && ok; ++column) {
+            ok = cudaMemcpyAsync(slot.device + column * chunk, slot.host + column * chunk, n * sizeof(double),
+                                 cudaMemcpyHostToDevice, slot.stream) == cudaSuccess;
+        }
+        if (!ok) {
+            break;
+        }
+
+        const double *d = slot.device;
+        unsigned blocks = static_cast<unsigned>((n + OFFLOAD_THREADS_PER_BLOCK - 1) / OFFLOAD_THREADS_PER_BLOCK);
+        if (curvature) {
+            colinearPointKernel<true><<<blocks, OFFLOAD_THREADS_PER_BLOCK, 0, slot.stream>>>(
+                d, d + chunk, d + 2 * chunk, d + 3 * chunk, d + 4 * chunk, n, slot.device + 5 * chunk,
+                slot.device + 6 * chunk);
+        } else {
+            colinearPointKernel<false><<<blocks, OFFLOAD_THREADS_PER_BLOCK, 0, slot.stream>>>(
+                d, d + chunk, d + 2 * chunk, d + 3 * chunk, d + 4 * chunk, n, slot.device + 5 * chunk,
+                slot.device + 6 * chunk);
+        }
+        ok = cudaGetLastError() == cudaSuccess
+            && cudaMemcpyAsync(slot.host + 5 * chunk, slot.device + 5 * chunk, n * sizeof(double),
+                               cudaMemcpyDeviceToHost, slot.stream) == cudaSuccess
+            && cudaMemcpyAsync(slot.host + 6 * chunk, slot.device + 6 * chunk, n * sizeof(double),
+                               cudaMemcpyDeviceToHost, slot.stream) == cudaSuccess;
+        slot.begin = begin;
+        slot.count = n;
+    }
+
+    // Drain both slots even after an error so the buffers are idle again
+    for (Slot &slot : context->slots) {
+        if (!finishSlot(context, slot, outX, outY)) {
+            ok = false;
+            slot.count = 0;
+        }
+    }
+    return ok;
+}
+
+}  // namespace cuda_offload
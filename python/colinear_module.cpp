@@ -0,0 +1,303 @@
+// ============================================
+// Python Extension Module
+// ============================================
+// Exposes the batch curve functions to Python as the module `colinear`.
+// Arrays are passed through the buffer protocol (PEP 3118), so NumPy
+// arrays, array.array('d') and memoryviews are read and written in place
+// with no copy and no NumPy build dependency. The GIL is released for the
+// duration of every batch, so Python threads working on separate arrays
+// run in parallel.
+//
+//   import numpy as np, colinear
+//   x, y = colinear.colinear_point_batch(x, y, theta, dlead, radius)
+//   colinear.colinear_point_batch(x, y, theta, dlead, radius, out_x=ox, out_y=oy)
+//
+// Inputs must be C-contiguous float64 buffers of equal length. Outputs
+// are allocated with numpy.empty() when NumPy is importable (else as
+// array.array('d')) unless out_x / out_y are given; they must be
+// writable, of the same length, and must not overlap any input.
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <cstring>
+#include "../headerFiLES/geometry.hpp"
+#include "../headerFiLES/simd.hpp"
+
+namespace {
+
+/**
+ * @brief Owns one exported buffer for the duration of a call
+ */
+struct BufferView {
+    Py_buffer view;
+    bool held = false;
+
+    BufferView() { std::memset(&view, 0, sizeof(view)); }
+    ~BufferView() {
+        if (held) {
+            PyBuffer_Release(&view);
+        }
+    }
+    BufferView(const BufferView &) = delete;
+    BufferView &operator=(const BufferView &) = delete;
+
+    double *data() const { return static_cast<double *>(view.buf); }
+    Py_ssize_t count() const { return view.len / static_cast<Py_ssize_t>(sizeof(double)); }
+};
+
+bool isFloat64Format(const char *format) {
+    if (format == nullptr) {
+        return false;  // Buffer without format information is raw bytes
+    }
+    if (format[0] == 'd' && format[1] == '\0') {
+        return true;
+    }
+    #if PY_LITTLE_ENDIAN
+        const char nativeOrder = '<';
+    #else
+        const char nativeOrder = '>';
+    #endif
+    return (format[0] == '=' || format[0] == '@' || format[0] == nativeOrder) && format[1] == 'd' && format[2] == '\0';
+}
+
+/**
+ * @brief Acquires a C-contiguous float64 buffer
+ * @return false with a Python exception set
+ */
+bool acquire(PyObject *object, const char *name, bool writable, BufferView &buffer) {
+    int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0);
+    if (PyObject_GetBuffer(object, &buffer.view, flags) != 0) {
+        PyErr_Format(PyExc_TypeError, "%s must be a C-contiguous%s float64 buffer", name,
+                     writable ? " writable" : "");
+        return false;
+    }
+    buffer.held = true;
+    if (buffer.view.itemsize != static_cast<Py_ssize_t>(sizeof(double)) || !isFloat64Format(buffer.view.format)) {
+        PyErr_Format(PyExc_TypeError, "%s must have dtype float64 (got format '%s')", name,
+                     buffer.view.format != nullptr ? buffer.view.format : "B");
+        return false;
+    }
+    return true;
+}
+
+bool overlaps(const BufferView &a, const BufferView &b) {
+    const char *a0 = static_cast<const char *>(a.view.buf);
+    const char *b0 = static_cast<const char *>(b.view.buf);
+    return a.view.len > 0 && b.view.len > 0 && a0 < b0 + b.view.len && b0 < a0 + a.view.len;
+}
+
+/**
+ * @brief New float64 array of count elements: numpy.empty() or array.array('d')
+ */
+PyObject *newOutputArray(Py_ssize_t count) {
+    PyObject *numpy = PyImport_ImportModule("numpy");
+    if (numpy != nullptr) {
+        PyObject *array = PyObject_CallMethod(numpy, "empty", "(n)s", count, "float64");
+        Py_DECREF(numpy);
+        return array;
+    }
+    PyErr_Clear();
+    PyObject *arrayModule = PyImport_ImportModule("array");
+    if (arrayModule == nullptr) {
+        return nullptr;
+    }
+    PyObject *zeros = PyBytes_FromStringAndSize(nullptr, count * static_cast<Py_ssize_t>(sizeof(double)));
+    PyObject *array = nullptr;
+    if (zeros != nullptr) {
+        std::memset(PyBytes_AS_STRING(zeros), 0, static_cast<std::size_t>(PyBytes_GET_SIZE(zeros)));
+        array = PyObject_CallMethod(arrayModule, "array", "(sO)", "d", zeros);
+        Py_DECREF(zeros);
+    }
+    Py_DECREF(arrayModule);
+    return array;
+}
+
+typedef void (*BatchFunction)(const double *, const double *, const double *, const double *, const double *,
+                              std::size_t, double *, double *);
+
+void radiusBatchExact(const double *x, const double *y, const double *theta, const double *dlead,
+                      const double *radius, std::size_t count, double *outX, double *outY) {
+    calculateColinearPointBatch(x, y, theta, dlead, radius, count, outX, outY);
+}
+
+void radiusBatchFast(const double *x, const double *y, const double *theta, const double *dlead,
+                     const double *radius, std::size_t count, double *outX, double *outY) {
+    calculateColinearPointBatchSimd(x, y, theta, dlead, radius, count, outX, outY);
+}
+
+void curvatureBatchExact(const double *x, const double *y, const double *theta, const double *dlead,
+                         const double *curvature, std::size_t count, double *outX, double *outY) {
+    calculateColinearPointWithCurvatureBatch(x, y, theta, dlead, curvature, count, outX, outY);
+}
+
+void curvatureBatchFast(const double *x, const double *y, const double *theta, const double *dlead,
+                        const double *curvature, std::size_t count, double *outX, double *outY) {
+    calculateColinearPointWithCurvatureBatchSimd(x, y, theta, dlead, curvature, count, outX, outY);
+}
+
+/**
+ * @brief Shared argument handling of the two batch functions
+ */
+PyObject *runBatch(PyObject *args, PyObject *kwargs, const char *shapeName, BatchFunction exact,
+                   BatchFunction fast) {
+    const char *keywords[] = {"x", "y", "theta", "dlead", shapeName, "out_x", "out_y", "exact", nullptr};
+    PyObject *inputObjects[5];
+    PyObject *outX = Py_None;
+    PyObject *outY = Py_None;
+    int useExact = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO|OO$p", const_cast<char **>(keywords), &inputObjects[0],
+                                     &inputObjects[1], &inputObjects[2], &inputObjects[3], &inputObjects[4], &outX,
+                                     &outY, &useExact)) {
+        return nullptr;
+    }
+
+    const char *inputNames[5] = {"x", "y", "theta", "dlead", shapeName};
+    BufferView inputs[5];
+    for (int i = 0; i < 5; ++i) {
+        if (!acquire(inputObjects[i], inputNames[i], false, inputs[i])) {
+            return nullptr;
+        }
+        if (inputs[i].count() != inputs[0].count()) {
+            PyErr_Format(PyExc_ValueError, "%s has %zd elements, x has %zd", inputNames[i], inputs[i].count(),
+                         inputs[0].count());
+            return nullptr;
+        }
+    }
+    Py_ssize_t count = inputs[0].count();
+
+    // Results: caller-provided arrays or fresh ones (new references either way)
+    PyObject *results[2] = {outX, outY};
+    for (int o = 0; o < 2; ++o) {
+        if (results[o] != Py_None) {
+            Py_INCREF(results[o]);
+            continue;
+        }
+        results[o] = newOutputArray(count);
+        if (results[o] == nullptr) {
+            if (o == 1) {
+                Py_DECREF(results[0]);
+            }
+            return nullptr;
+        }
+    }
+    PyObject *tuple = PyTuple_Pack(2, results[0], results[1]);
+    Py_DECREF(results[0]);
+    Py_DECREF(results[1]);
+    if (tuple == nullptr) {
+        return nullptr;
+    }
+
+    const char *outputNames[2] = {"out_x", "out_y"};
+    BufferView outputs[2];
+    for (int o = 0; o < 2; ++o) {
+        if (!acquire(PyTuple_GET_ITEM(tuple, o), outputNames[o], true, outputs[o])) {
+            Py_DECREF(tuple);
+            return nullptr;
+        }
+        if (outputs[o].count() != count) {
+            PyErr_Format(PyExc_ValueError, "%s has %zd elements, expected %zd", outputNames[o], outputs[o].count(),
+                         count);
+            Py_DECREF(tuple);
+            return nullptr;
+        }
+        for (int i = 0; i < 5; ++i) {
+            if (overlaps(outputs[o], inputs[i])) {
+                PyErr_Format(PyExc_ValueError, "%s must not overlap %s", outputNames[o], inputNames[i]);
+                Py_DECREF(tuple);
+                return nullptr;
+            }
+        }
+    }
+    if (overlaps(outputs[0], outputs[1])) {
+        PyErr_SetString(PyExc_ValueError, "out_x and out_y must not overlap");
+        Py_DECREF(tuple);
+        return nullptr;
+    }
+
+    BatchFunction batch = useExact ? exact : fast;
+    Py_BEGIN_ALLOW_THREADS
+    batch(inputs[0].data(), inputs[1].data(), inputs[2].data(), inputs[3].data(), inputs[4].data(),
+          static_cast<std::size_t>(count), outputs[0].data(), outputs[1].data());
+    Py_END_ALLOW_THREADS
+    return tuple;
+}
+
+PyObject *colinearPointBatch(PyObject *, PyObject *args, PyObject *kwargs) {
+    return runBatch(args, kwargs, "radius", radiusBatchExact, radiusBatchFast);
+}
+
+PyObject *colinearPointWithCurvatureBatch(PyObject *, PyObject *args, PyObject *kwargs) {
+    return runBatch(args, kwargs, "curvature", curvatureBatchExact, curvatureBatchFast);
+}
+
+PyObject *colinearPoint(PyObject *, PyObject *args, PyObject *kwargs) {
+    const char *keywords[] = {"x", "y", "theta", "dlead", "radius", nullptr};
+    double x, y, theta, dlead;
+    double radius = DEFAULT_CURVATURE_RADIUS;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "dddd|d", const_cast<char **>(keywords), &x, &y, &theta, &dlead,
+                                     &radius)) {
+        return nullptr;
+    }
+    Point p = calculateColinearPoint(x, y, theta, dlead, radius);
+    return Py_BuildValue("(dd)", p.x, p.y);
+}
+
+PyObject *colinearPointWithCurvature(PyObject *, PyObject *args, PyObject *kwargs) {
+    const char *keywords[] = {"x", "y", "theta", "dlead", "curvature", nullptr};
+    double x, y, theta, dlead, curvature;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "ddddd", const_cast<char **>(keywords), &x, &y, &theta, &dlead,
+                                     &curvature)) {
+        return nullptr;
+    }
+    Point p = calculateColinearPointWithCurvature(x, y, theta, dlead, curvature);
+    return Py_BuildValue("(dd)", p.x, p.y);
+}
+
+PyObject *simdLevel(PyObject *, PyObject *) {
+    return PyUnicode_FromString(simdLevelName(activeSimdLevel()));
+}
+
+PyMethodDef methods[] = {
+    {"colinear_point_batch", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(colinearPointBatch)),
+     METH_VARARGS | METH_KEYWORDS,
+     "colinear_point_batch(x, y, theta, dlead, radius, out_x=None, out_y=None, *, exact=False) -> (out_x, out_y)\n\n"
+     "Batch calculateColinearPoint(). exact=True uses the scalar reference loop\n"
+     "instead of the SIMD kernels (which agree to a few ULP)."},
+    {"colinear_point_with_curvature_batch",
+     reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(colinearPointWithCurvatureBatch)),
+     METH_VARARGS | METH_KEYWORDS,
+     "colinear_point_with_curvature_batch(x, y, theta, dlead, curvature, out_x=None, out_y=None, *, exact=False)"
+     " -> (out_x, out_y)\n\n"
+     "Batch calculateColinearPointWithCurvature()."},
+    {"colinear_point", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(colinearPoint)),
+     METH_VARARGS | METH_KEYWORDS,
+     "colinear_point(x, y, theta, dlead, radius=1.0) -> (x, y)\n\nSingle calculateColinearPoint() call."},
+    {"colinear_point_with_curvature",
+     reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(colinearPointWithCurvature)),
+     METH_VARARGS | METH_KEYWORDS,
+     "colinear_point_with_curvature(x, y, theta, dlead, curvature) -> (x, y)\n\n"
+     "Single calculateColinearPointWithCurvature() call."},
+    {"simd_level", simdLevel, METH_NOARGS, "simd_level() -> str\n\nSIMD kernel used by the batch functions."},
+    {nullptr, nullptr, 0, nullptr}};
+
+PyModuleDef moduleDef = {
+    PyModuleDef_HEAD_INIT,
+    "colinear",
+    "Boomerang curve colinear point calculator (batch calls take float64 buffers, e.g. NumPy arrays, without copying)",
+    -1,
+    methods,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr};
+
+}  // namespace
+
+PyMODINIT_FUNC PyInit_colinear() {
+    activeSimdLevel();  // CPU detection before any call runs without the GIL
+    PyObject *module = PyModule_Create(&moduleDef);
+    if (module == nullptr) {
+        return nullptr;
+    }
+    PyModule_AddObject(module, "DEFAULT_CURVATURE_RADIUS", PyFloat_FromDouble(DEFAULT_CURVATURE_RADIUS));
+    return module;
+}
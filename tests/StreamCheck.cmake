@@ -0,0 +1,76 @@
+# ============================================
+# Headless CLI Regression Check
+# ============================================
+# Runs the calculator's --stream mode (scalar and --fast) on headings that
+# are the same angle modulo 360 degrees and requires identical lines,
+# then checks the size of a --sweep file and that --binary rejects it.
+#
+# Usage: cmake -DCOLLINEAR=path/to/collinear -DWORK_DIR=dir -P StreamCheck.cmake
+
+if(NOT COLLINEAR OR NOT WORK_DIR)
+    message(FATAL_ERROR "StreamCheck.cmake needs -DCOLLINEAR=... and -DWORK_DIR=...")
+endif()
+file(MAKE_DIRECTORY "${WORK_DIR}")
+
+# Columns: x y theta dlead radius; theta 725, 5 and -355 degrees coincide
+set(input "${WORK_DIR}/stream_check_poses.txt")
+file(WRITE "${input}" "1.5 -2 725 2 1\n1.5 -2 5 2 1\n1.5 -2 -355 2 1\n")
+
+foreach(mode "" "--fast")
+    execute_process(
+        COMMAND "${COLLINEAR}" --stream --degrees ${mode} --input "${input}"
+        RESULT_VARIABLE result
+        OUTPUT_VARIABLE output
+        ERROR_VARIABLE errors)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "collinear --stream --degrees ${mode} failed (${result}): ${errors}")
+    endif()
+    string(STRIP "${output}" output)
+    string(REPLACE "\n" ";" lines "${output}")
+    list(LENGTH lines lineCount)
+    list(GET lines 0 first)
+    if(mode STREQUAL "")
+        set(scalarFirst "${first}")
+    endif()
+    list(REMOVE_DUPLICATES lines)
+    list(LENGTH lines distinct)
+    if(NOT lineCount EQUAL 3 OR NOT distinct EQUAL 1)
+        message(FATAL_ERROR "--stream --degrees ${mode}: equal headings gave different points:\n${output}")
+    endif()
+endforeach()
+
+# 725 degrees wraps to 5: the scalar result must match 5 degrees given in radians
+file(WRITE "${input}" "1.5 -2 0.087266462599716474 2 1\n")
+execute_process(
+    COMMAND "${COLLINEAR}" --stream --input "${input}"
+    RESULT_VARIABLE result
+    OUTPUT_VARIABLE radiansOutput
+    OUTPUT_STRIP_TRAILING_WHITESPACE)
+if(NOT result EQUAL 0 OR NOT radiansOutput STREQUAL scalarFirst)
+    message(FATAL_ERROR "5 degrees as radians gave '${radiansOutput}', 725 degrees gave '${scalarFirst}'")
+endif()
+
+# A sweep writes a complete point file, which --binary must refuse as input
+set(grid "${WORK_DIR}/stream_check_grid.cpcb")
+set(points "${WORK_DIR}/stream_check_points.cpcb")
+execute_process(
+    COMMAND "${COLLINEAR}" --sweep --theta 0:15:24 --dlead 0:0.5:40 --radius 1:1:3 --degrees --output "${grid}"
+    RESULT_VARIABLE result
+    ERROR_VARIABLE errors)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "collinear --sweep failed (${result}): ${errors}")
+endif()
+file(SIZE "${grid}" gridSize)
+# 32-byte header + 24 * 40 * 3 points * 2 float64 columns
+if(NOT gridSize EQUAL 46112)
+    message(FATAL_ERROR "sweep output is ${gridSize} bytes, expected 46112")
+endif()
+# A point file is not a pose file: --binary must refuse it
+execute_process(
+    COMMAND "${COLLINEAR}" --binary --input "${grid}" --output "${points}"
+    RESULT_VARIABLE result
+    ERROR_QUIET)
+if(result EQUAL 0)
+    message(FATAL_ERROR "collinear --binary accepted a point file as input")
+endif()
+file(REMOVE "${input}" "${grid}" "${points}")
@@ -0,0 +1,83 @@
+#pragma once
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include "../headerFiLES/geometry.hpp"
+
+// ============================================
+// Regression Check Helpers
+// ============================================
+// Minimal assertion macros for the programs in tests/. A failed check
+// prints its location and expression and the program carries on, so one
+// ctest run reports every failure; main() returns checkExitCode().
+
+namespace check_detail {
+
+inline int &failureCount() {
+    static int count = 0;
+    return count;
+}
+
+inline void fail(const char *file, int line, const char *expression) {
+    ++failureCount();
+    std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+}
+
+inline void failNear(const char *file, int line, const char *expression, double a, double b, double tolerance) {
+    ++failureCount();
+    std::fprintf(stderr, "%s:%d: check failed: %s (%.17g vs %.17g, tolerance %.3g)\n", file, line, expression, a,
+                 b, tolerance);
+}
+
+}  // namespace check_detail
+
+/**
+ * @brief True if a and b have the same bit pattern (NaN payloads and zero signs included)
+ */
+inline bool sameBits(double a, double b) {
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+/**
+ * @brief Tolerance for a libm-accurate path against the scalar reference
+ *
+ * 1e-12 normally. In COLINEAR_TRIG_LUT builds the reference itself takes
+ * sin/cos from the lookup table, so the bound grows by the table's error
+ * times scale, the largest radius or arc offset the trig results multiply.
+ */
+inline double referenceTolerance(double scale) {
+    #if defined(COLINEAR_TRIG_LUT)
+        return 1e-12 + 4.0 * scale * trigBackendInfo().maxError;
+    #else
+        (void)scale;
+        return 1e-12;
+    #endif
+}
+
+#define CHECK(condition)                                              \
+    do {                                                              \
+        if (!(condition)) {                                           \
+            check_detail::fail(__FILE__, __LINE__, #condition);       \
+        }                                                             \
+    } while (0)
+
+#define CHECK_NEAR(a, b, tolerance)                                                             \
+    do {                                                                                        \
+        double checkA_ = (a);                                                                   \
+        double checkB_ = (b);                                                                   \
+        if (!(std::abs(checkA_ - checkB_) <= (tolerance))) {                                    \
+            check_detail::failNear(__FILE__, __LINE__, #a " ~ " #b, checkA_, checkB_, tolerance); \
+        }                                                                                       \
+    } while (0)
+
+/**
+ * @brief 0 if every check passed, 1 otherwise (with a summary on stderr)
+ */
+inline int checkExitCode() {
+    int failures = check_detail::failureCount();
+    if (failures != 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
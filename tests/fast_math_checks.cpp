@@ -0,0 +1,80 @@
+// ============================================
+// Fast-Math Regression Checks
+// ============================================
+// Built with -ffast-math (GCC / Clang) or /fp:fast (MSVC) regardless of
+// COLINEAR_FP_MODEL. The 1.5 * 2^52 rounding shift in angles.hpp,
+// cache.hpp and realtime.hpp must survive that; without the barrier in
+// shiftedForRounding() the compiler folds (v + shift) - shift to v, every
+// turn count below becomes 0, cache keys stop quantizing and the
+// real-time sincos loses its quadrant reduction.
+#include <cmath>
+#include "../headerFiLES/angles.hpp"
+#include "../headerFiLES/cache.hpp"
+#include "../headerFiLES/realtime.hpp"
+#include "checks.hpp"
+
+#if !defined(__FAST_MATH__) && !defined(_M_FP_FAST)
+    #error "fast_math_checks.cpp must be compiled with -ffast-math"
+#endif
+
+// Keeps the inputs opaque so the checks exercise the runtime path
+static double opaque(double value) {
+    volatile double v = value;
+    return v;
+}
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1925
+static_assert(wrapDegrees(725.0) == 5.0, "constant-evaluated wrapDegrees() must reduce");
+static_assert(wrapDegrees(-190.0) == 170.0, "constant-evaluated wrapDegrees() must reduce");
+#endif
+
+static void checkAngles() {
+    CHECK(wrapDegrees(opaque(725.0)) == 5.0);
+    CHECK(wrapDegrees(opaque(-725.0)) == -5.0);
+    CHECK(wrapDegrees(opaque(540.0)) == -180.0);
+    CHECK(wrapDegrees(opaque(3600000.25)) == 0.25);
+    CHECK_NEAR(wrapAngle(opaque(7.0)), 0.71681469282041377, 1e-15);
+    CHECK_NEAR(wrapAngle(opaque(-7.0)), -0.71681469282041377, 1e-15);
+    CHECK_NEAR(wrapAngle(opaque(1000.0)), 1000.0 - 159.0 * 2.0 * M_PI, 1e-12);
+    CHECK(wrappedDegreesToRadians(opaque(725.0)) == degreesToRadians(5.0));
+
+    double degrees[4] = {725.0, -725.0, 365.0, 10.0};
+    double wrapped[4];
+    wrapDegreesBatch(degrees, 4, wrapped);
+    CHECK(wrapped[0] == 5.0 && wrapped[1] == -5.0 && wrapped[2] == 5.0 && wrapped[3] == 10.0);
+}
+
+static void checkCache() {
+    // 1.00004 and 0.99996 both quantize to 10000 steps of 1e-4
+    ColinearPointCache cache;
+    Point first = cache.lookup(0.0, 0.0, opaque(1.00004), 2.0, 1.0);
+    Point second = cache.lookup(0.0, 0.0, opaque(0.99996), 2.0, 1.0);
+    CHECK(cache.stats().misses == 1);
+    CHECK(cache.stats().hits == 1);
+    CHECK(first.x == second.x && first.y == second.y);
+    Point quantized = calculateColinearPoint(0.0, 0.0, 1.0, 2.0, 1.0);
+    CHECK_NEAR(first.x, quantized.x, 1e-12);
+    CHECK_NEAR(first.y, quantized.y, 1e-12);
+}
+
+static void checkRealtime() {
+    const double thetas[] = {1.0, -2.5, 3.9, 100.0};
+    for (double theta : thetas) {
+        Point rt = rtColinearPoint(0.0, 0.0, opaque(theta), 2.0, 1.0);
+        Point ref = calculateColinearPoint(0.0, 0.0, theta, 2.0, 1.0);
+        CHECK_NEAR(rt.x, ref.x, referenceTolerance(16.0));
+        CHECK_NEAR(rt.y, ref.y, referenceTolerance(16.0));
+    }
+    double s = 0.0;
+    double c = 0.0;
+    rt_detail::sinCos(opaque(7.0), s, c);
+    CHECK_NEAR(s, std::sin(7.0), 1e-15);
+    CHECK_NEAR(c, std::cos(7.0), 1e-15);
+}
+
+int main() {
+    checkAngles();
+    checkCache();
+    checkRealtime();
+    return checkExitCode();
+}
@@ -0,0 +1,331 @@
+// ============================================
+// Geometry Regression Checks
+// ============================================
+// Pins the equivalences the batch, SIMD, parallel, sampling, cache,
+// real-time, clothoid and path code promise against the scalar
+// calculateColinearPoint() / ..WithCurvature() reference:
+//
+// - batch and sampling entry points: bit-identical per element;
+// - parallel drivers: bit-identical to the serial SIMD call;
+// - SIMD, real-time and recurrence paths: within a few ULP (1e-12 abs
+//   on the coordinates used here, widened by the table error in
+//   COLINEAR_TRIG_LUT builds);
+// - angle wrapping, cache quantization, clothoid and path evaluation on
+//   hand-checked values.
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+#include "../headerFiLES/angles.hpp"
+#include "../headerFiLES/cache.hpp"
+#include "../headerFiLES/clothoid.hpp"
+#include "../headerFiLES/parallel.hpp"
+#include "../headerFiLES/path.hpp"
+#include "../headerFiLES/realtime.hpp"
+#include "../headerFiLES/simd.hpp"
+#include "checks.hpp"
+
+// Tolerance for paths that are not bit-identical to the scalar reference,
+// relative to the coordinate magnitude once it exceeds 1 (radii and arc
+// offsets here stay below 16 units unless a check says otherwise)
+const double NEAR_TOLERANCE = referenceTolerance(16.0);
+
+static double nearTolerance(double reference) {
+    return NEAR_TOLERANCE * std::fmax(1.0, std::abs(reference));
+}
+
+struct Poses {
+    std::vector<double> x, y, theta, dlead, radius, curvature;
+};
+
+/**
+ * @brief Random poses followed by every clamp / fallback edge case
+ */
+static Poses makePoses(std::size_t count) {
+    Poses p;
+    std::mt19937_64 rng(2024);
+    std::uniform_real_distribution<double> pos(-50.0, 50.0);
+    std::uniform_real_distribution<double> ang(-7.0, 7.0);
+    std::uniform_real_distribution<double> len(-20.0, 20.0);
+    std::uniform_real_distribution<double> rad(0.2, 30.0);
+    for (std::size_t i = 0; i < count; ++i) {
+        double r = rad(rng);
+        p.x.push_back(pos(rng));
+        p.y.push_back(pos(rng));
+        p.theta.push_back(ang(rng));
+        p.dlead.push_back(len(rng));
+        p.radius.push_back(i % 3 == 0 ? -r : r);
+        p.curvature.push_back(i % 2 == 0 ? 1.0 / r : -1.0 / r);
+    }
+    const double dleads[] = {0.0, MIN_DLEAD * 0.5, -MIN_DLEAD * 0.5, MIN_DLEAD, 2.0 * MAX_DLEAD, -2.0 * MAX_DLEAD};
+    const double radii[] = {0.0, EPSILON * 0.5, 1.0, -3.0};
+    const double curvatures[] = {0.0, EPSILON * 0.5, -EPSILON * 0.5, EPSILON * 2.0, 1e3};
+    for (double d : dleads) {
+        for (std::size_t k = 0; k < 5; ++k) {
+            p.x.push_back(1.5);
+            p.y.push_back(-2.0);
+            p.theta.push_back(0.25 * static_cast<double>(k));
+            p.dlead.push_back(d);
+            p.radius.push_back(radii[k % 4]);
+            p.curvature.push_back(curvatures[k]);
+        }
+    }
+    // |curvature| > 1 / EPSILON: the radius falls back to DEFAULT_CURVATURE_RADIUS
+    for (double c : {2e9, -2e9}) {
+        for (std::size_t k = 0; k < 8; ++k) {
+            p.x.push_back(0.0);
+            p.y.push_back(0.0);
+            p.theta.push_back(0.0);
+            p.dlead.push_back(1e-5);
+            p.radius.push_back(1.0 / c);
+            p.curvature.push_back(c);
+        }
+    }
+    return p;
+}
+
+static void checkBatchesMatchScalar(const Poses &p) {
+    std::size_t n = p.x.size();
+    std::vector<double> outX(n), outY(n);
+    calculateColinearPointBatch(p.x.data(), p.y.data(), p.theta.data(), p.dlead.data(), p.radius.data(), n,
+                                outX.data(), outY.data());
+    for (std::size_t i = 0; i < n; ++i) {
+        Point ref = calculateColinearPoint(p.x[i], p.y[i], p.theta[i], p.dlead[i], p.radius[i]);
+        CHECK(sameBits(outX[i], ref.x) && sameBits(outY[i], ref.y));
+    }
+
+    calculateColinearPointWithCurvatureBatch(p.x.data(), p.y.data(), p.theta.data(), p.dlead.data(),
+                                             p.curvature.data(), n, outX.data(), outY.data());
+    for (std::size_t i = 0; i < n; ++i) {
+        Point ref = calculateColinearPointWithCurvature(p.x[i], p.y[i], p.theta[i], p.dlead[i], p.curvature[i]);
+        CHECK(sameBits(outX[i], ref.x) && sameBits(outY[i], ref.y));
+    }
+}
+
+/**
+ * @brief Batch calls count the same branch events as the scalar loop (COLINEAR_INSTRUMENT builds)
+ */
+static void checkBatchCounters(const Poses &p) {
+    std::size_t n = p.x.size();
+    std::vector<double> outX(n), outY(n);
+    resetCurveCounters();
+    for (std::size_t i = 0; i < n; ++i) {
+        calculateColinearPoint(p.x[i], p.y[i], p.theta[i], p.dlead[i], p.radius[i]);
+        calculateColinearPointWithCurvature(p.x[i], p.y[i], p.theta[i], p.dlead[i], p.curvature[i]);
+    }
+    CurveCounterSnapshot scalar = snapshotCurveCounters();
+    if (!scalar.enabled) {
+        return;
+    }
+    resetCurveCounters();
+    calculateColinearPointBatch(p.x.data(), p.y.data(), p.theta.data(), p.dlead.data(), p.radius.data(), n,
+                                outX.data(), outY.data());
+    calculateColinearPointWithCurvatureBatch(p.x.data(), p.y.data(), p.theta.data(), p.dlead.data(),
+                                             p.curvature.data(), n, outX.data(), outY.data());
+    CurveCounterSnapshot batch = snapshotCurveCounters();
+    for (std::size_t e = 0; e < CURVE_EVENT_COUNT; ++e) {
+        CHECK(batch.events[e] == scalar.events[e]);
+    }
+    resetCurveCounters();
+}
+
+static void checkSimdAndParallel(const Poses &p) {
+    std::size_t n = p.x.size();
+    std::vector<double> simdX(n), simdY(n), parX(n), parY(n);
+    calculateColinearPointBatchSimd(p.x.data(), p.y.data(), p.theta.data(), p.dlead.data(), p.radius.data(), n,
+                                    simdX.data(), simdY.data());
+    for (std::size_t i = 0; i < n; ++i) {
+        Point ref = calculateColinearPoint(p.x[i], p.y[i], p.theta[i], p.dlead[i], p.radius[i]);
+        CHECK_NEAR(simdX[i], ref.x, nearTolerance(ref.x));
+        CHECK_NEAR(simdY[i], ref.y, nearTolerance(ref.y));
+    }
+
+    WorkStealingPool pool(3);
+    parallelColinearPointBatch(pool, p.x.data(), p.y.data(), p.theta.data(), p.dlead.data(), p.radius.data(), n,
+                               parX.data(), parY.data(), 8);
+    for (std::size_t i = 0; i < n; ++i) {
+        CHECK(sameBits(parX[i], simdX[i]) && sameBits(parY[i], simdY[i]));
+    }
+
+    calculateColinearPointWithCurvatureBatchSimd(p.x.data(), p.y.data(), p.theta.data(), p.dlead.data(),
+                                                 p.curvature.data(), n, simdX.data(), simdY.data());
+    parallelColinearPointWithCurvatureBatch(pool, p.x.data(), p.y.data(), p.theta.data(), p.dlead.data(),
+                                            p.curvature.data(), n, parX.data(), parY.data(), 8);
+    for (std::size_t i = 0; i < n; ++i) {
+        Point ref = calculateColinearPointWithCurvature(p.x[i], p.y[i], p.theta[i], p.dlead[i], p.curvature[i]);
+        // Near the straight-line threshold the radius is ~1e9
+        double radius = std::abs(p.curvature[i]) < EPSILON ? 0.0 : 1.0 / std::abs(p.curvature[i]);
+        double trig = referenceTolerance(3.0 * radius);
+        CHECK_NEAR(simdX[i], ref.x, std::fmax(nearTolerance(ref.x), trig));
+        CHECK_NEAR(simdY[i], ref.y, std::fmax(nearTolerance(ref.y), trig));
+        CHECK(sameBits(parX[i], simdX[i]) && sameBits(parY[i], simdY[i]));
+    }
+}
+
+static void checkSampling() {
+    PoseContext pose = makePoseContext(3.0, -1.0, 0.7);
+    std::vector<double> dleads;
+    for (int i = 0; i < 200; ++i) {
+        dleads.push_back(-5.0 + 0.05 * i);
+    }
+    std::vector<Point> out(dleads.size());
+    sampleColinearPoints(pose, dleads.data(), dleads.size(), 2.5, out.data());
+    for (std::size_t i = 0; i < dleads.size(); ++i) {
+        Point ref = calculateColinearPoint(3.0, -1.0, 0.7, dleads[i], 2.5);
+        CHECK(sameBits(out[i].x, ref.x) && sameBits(out[i].y, ref.y));
+    }
+    sampleColinearPointsUniform(pose, -5.0, 0.05, dleads.size(), 2.5, out.data());
+    // The recurrence compounds one step's trig error per sample
+    double tolerance = referenceTolerance(2.5 * static_cast<double>(dleads.size()));
+    for (std::size_t i = 0; i < dleads.size(); ++i) {
+        Point ref = calculateColinearPoint(pose, -5.0 + static_cast<double>(i) * 0.05, 2.5);
+        CHECK_NEAR(out[i].x, ref.x, tolerance);
+        CHECK_NEAR(out[i].y, ref.y, tolerance);
+    }
+}
+
+static void checkAngles() {
+    CHECK(wrapDegrees(725.0) == 5.0);
+    CHECK(wrapDegrees(-725.0) == -5.0);
+    CHECK(wrapDegrees(180.0) == -180.0);
+    CHECK(wrapDegrees(-180.0) == -180.0);
+    CHECK(wrapDegrees(3600000.25) == 0.25);
+    CHECK_NEAR(wrapAngle(7.0), 7.0 - 2.0 * M_PI, 1e-15);
+    CHECK_NEAR(wrapAngle(-7.0), 2.0 * M_PI - 7.0, 1e-15);
+    CHECK_NEAR(wrapAngle(1000.0), 1000.0 - 159.0 * 2.0 * M_PI, 1e-12);
+    CHECK(wrapAngle(M_PI) == -M_PI);
+    CHECK(std::isnan(wrapAngle(INFINITY)));
+    CHECK(wrappedDegreesToRadians(725.0) == degreesToRadians(5.0));
+
+    Point degrees = calculateColinearPointDegrees(1.0, 2.0, 725.0, 3.0, 4.0);
+    Point radians = calculateColinearPoint(1.0, 2.0, degreesToRadians(5.0), 3.0, 4.0);
+    CHECK(sameBits(degrees.x, radians.x) && sameBits(degrees.y, radians.y));
+}
+
+static void checkCache() {
+    // Both headings round to 10000 steps of 1e-4: one miss, then a hit
+    ColinearPointCache cache;
+    Point first = cache.lookup(0.0, 0.0, 1.00004, 2.0, 1.0);
+    Point second = cache.lookup(0.0, 0.0, 0.99996, 2.0, 1.0);
+    Point quantized = calculateColinearPoint(0.0, 0.0, 10000.0 * 1e-4, 2.0, 1.0);
+    CHECK(cache.stats().misses == 1);
+    CHECK(cache.stats().hits == 1);
+    CHECK(sameBits(first.x, second.x) && sameBits(first.y, second.y));
+    CHECK_NEAR(first.x, quantized.x, NEAR_TOLERANCE);
+    CHECK_NEAR(first.y, quantized.y, NEAR_TOLERANCE);
+
+    // Position only enters through the translation
+    Point moved = cache.lookup(10.0, -4.0, 1.0, 2.0, 1.0);
+    CHECK(cache.stats().hits == 2);
+    CHECK_NEAR(moved.x, first.x + 10.0, NEAR_TOLERANCE);
+    CHECK_NEAR(moved.y, first.y - 4.0, NEAR_TOLERANCE);
+
+    // A radius below half a step is not radius 0 (the default-radius fallback)
+    Point tiny = cache.lookup(0.0, 0.0, 0.0, 2.0, 3e-5);
+    Point direct = calculateColinearPoint(0.0, 0.0, 0.0, 2.0, 3e-5);
+    CHECK(sameBits(tiny.x, direct.x) && sameBits(tiny.y, direct.y));
+    CHECK(cache.stats().bypasses == 1);
+    Point zero = cache.lookup(0.0, 0.0, 0.0, 2.0, 0.0);
+    direct = calculateColinearPoint(0.0, 0.0, 0.0, 2.0, 0.0);
+    CHECK_NEAR(zero.x, direct.x, NEAR_TOLERANCE);
+    CHECK_NEAR(zero.y, direct.y, NEAR_TOLERANCE);
+    CHECK(cache.stats().bypasses == 1);
+
+    // Cleanup only on the translated point; stay keys leave the pose alone
+    Point stay = cache.lookup(5e-10, 0.0, 0.0, 0.0, 1.0);
+    CHECK(stay.x == 5e-10 && stay.y == 0.0);
+    ColinearPointCache fine(64, CacheQuantization{1e-4, 1e-6, 1e-6});
+    Point tinyOffset = fine.lookup(0.0, 1.0, 0.0, 2e-5, 1.0);
+    direct = calculateColinearPoint(0.0, 1.0, 0.0, 2e-5, 1.0);
+    CHECK(tinyOffset.y > 1.0);
+    CHECK_NEAR(tinyOffset.x, direct.x, NEAR_TOLERANCE);
+    CHECK_NEAR(tinyOffset.y, direct.y, NEAR_TOLERANCE);
+    Point line = fine.lookupWithCurvature(5e-10, 0.0, 0.5, 0.0, 0.0);
+    direct = calculateColinearPointWithCurvature(5e-10, 0.0, 0.5, 0.0, 0.0);
+    CHECK(sameBits(line.x, direct.x) && sameBits(line.y, direct.y));
+}
+
+static void checkRealtime(const Poses &p) {
+    for (std::size_t i = 0; i < p.x.size(); ++i) {
+        Point rt = rtColinearPoint(p.x[i], p.y[i], p.theta[i], p.dlead[i], p.radius[i]);
+        Point ref = calculateColinearPoint(p.x[i], p.y[i], p.theta[i], p.dlead[i], p.radius[i]);
+        CHECK_NEAR(rt.x, ref.x, nearTolerance(ref.x));
+        CHECK_NEAR(rt.y, ref.y, nearTolerance(ref.y));
+
+        // Just above the straight-line threshold the radius is ~1e9 and
+        // r * (1 - cos phi) cancels in both implementations alike; far
+        // above it phi is large and the real-time reduction loses ULPs
+        // (the accuracy harness covers those inputs)
+        double phi = std::abs(p.dlead[i] * p.curvature[i]);
+        if (std::abs(p.curvature[i]) < 1e-6 || phi > 1e3) {
+            continue;
+        }
+        rt = rtColinearPointWithCurvature(p.x[i], p.y[i], p.theta[i], p.dlead[i], p.curvature[i]);
+        ref = calculateColinearPointWithCurvature(p.x[i], p.y[i], p.theta[i], p.dlead[i], p.curvature[i]);
+        CHECK_NEAR(rt.x, ref.x, nearTolerance(ref.x));
+        CHECK_NEAR(rt.y, ref.y, nearTolerance(ref.y));
+    }
+    Point rt = rtColinearPoint(0.0, 0.0, 1.0, 2.0, 1.0);
+    Point ref = calculateColinearPoint(0.0, 0.0, 1.0, 2.0, 1.0);
+    CHECK_NEAR(rt.x, ref.x, NEAR_TOLERANCE);
+    CHECK_NEAR(rt.y, ref.y, NEAR_TOLERANCE);
+}
+
+static void checkClothoidAndPath() {
+    // Zero curvature rate is the left arc of calculateColinearPoint()
+    for (double dlead : {0.5, 3.0, 11.0}) {
+        Point clothoid = calculateClothoidPoint(1.0, 2.0, 0.3, dlead, 0.25, 0.0);
+        Point arc = calculateColinearPoint(1.0, 2.0, 0.3, dlead, 4.0);
+        CHECK_NEAR(clothoid.x, arc.x, NEAR_TOLERANCE);
+        CHECK_NEAR(clothoid.y, arc.y, NEAR_TOLERANCE);
+    }
+    double c = 0.0;
+    double s = 0.0;
+    fresnelIntegrals(1.0, c, s);
+    CHECK_NEAR(c, 0.77989340037682282, 1e-14);
+    CHECK_NEAR(s, 0.43825914739035476, 1e-14);
+
+    SegmentPath path(1.0, 2.0, 0.3);
+    CHECK(path.appendLine(4.0));
+    CHECK(path.appendClothoid(0.0, 0.2, 5.0));
+    CHECK(path.appendArc(0.2, 7.0));
+    CHECK(path.appendClothoid(0.2, -0.1, 6.0));
+    CHECK(!path.appendLine(-1.0));
+    CHECK(path.segmentCount() == 4);
+    CHECK(path.length() == 22.0);
+    for (std::size_t i = 1; i < path.segmentCount(); ++i) {
+        Point end = path.pointOnSegment(i - 1, path.segmentStart(i));
+        Point start = path.pointOnSegment(i, path.segmentStart(i));
+        CHECK_NEAR(end.x, start.x, NEAR_TOLERANCE);
+        CHECK_NEAR(end.y, start.y, NEAR_TOLERANCE);
+    }
+    std::vector<double> s2;
+    for (int i = -5; i < 240; ++i) {
+        s2.push_back(0.1 * i);
+    }
+    std::vector<Point> batch(s2.size());
+    path.pointsAtBatch(s2.data(), s2.size(), batch.data());
+    PathCursor cursor(path);
+    for (std::size_t i = 0; i < s2.size(); ++i) {
+        Point direct = path.pointAt(s2[i]);
+        Point walked = cursor.pointAt(s2[i]);
+        CHECK(sameBits(batch[i].x, direct.x) && sameBits(batch[i].y, direct.y));
+        CHECK(sameBits(walked.x, direct.x) && sameBits(walked.y, direct.y));
+    }
+    Point line = path.pointAt(2.0);
+    CHECK_NEAR(line.x, 1.0 + 2.0 * std::cos(0.3), NEAR_TOLERANCE);
+    CHECK_NEAR(line.y, 2.0 + 2.0 * std::sin(0.3), NEAR_TOLERANCE);
+}
+
+int main() {
+    Poses poses = makePoses(4096);
+    checkBatchesMatchScalar(poses);
+    checkBatchCounters(poses);
+    checkSimdAndParallel(poses);
+    checkSampling();
+    checkAngles();
+    checkCache();
+    checkRealtime(poses);
+    checkClothoidAndPath();
+    return checkExitCode();
+}
@@ -0,0 +1,328 @@
+// ============================================
+// Binary I/O, Sweep and Argument Regression Checks
+// ============================================
+// Round-trips pose files through runBinary(), compares --sweep output
+// with direct evaluation, and pins the headless argument validation.
+// Scratch files go to the directory given as argv[1] (ctest passes the
+// build directory), or the working directory.
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+#include "../headerFiLES/binaryio.hpp"
+#include "../headerFiLES/stream.hpp"
+#include "../headerFiLES/sweep.hpp"
+#include "checks.hpp"
+
+static std::string scratchDir;
+
+static std::string scratchPath(const char *name) {
+    return scratchDir.empty() ? std::string(name) : scratchDir + "/" + name;
+}
+
+static bool parseArgs(std::vector<const char *> args, StreamOptions &options, std::string &error) {
+    args.insert(args.begin(), "collinear");
+    return parseStreamArgs(static_cast<int>(args.size()), const_cast<char **>(args.data()), options, error);
+}
+
+static void checkBinaryRoundTrip(BinaryScalar scalar, BinaryParam param) {
+    const std::size_t count = 3 * BINARY_CHUNK_SIZE / 2 + 7;  // crosses a chunk boundary
+    std::vector<double> x(count), y(count), theta(count), dlead(count), p(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        double t = static_cast<double>(i);
+        x[i] = std::fmod(t * 0.37, 20.0) - 10.0;
+        y[i] = std::fmod(t * 0.71, 20.0) - 10.0;
+        theta[i] = std::fmod(t * 0.013, 12.0) - 6.0;
+        dlead[i] = std::fmod(t * 0.11, 30.0) - 5.0;
+        double r = 0.5 + std::fmod(t * 0.29, 10.0);
+        p[i] = param == BinaryParam::Radius ? (i % 4 == 0 ? -r : r) : (i % 5 == 0 ? 0.0 : 1.0 / r);
+    }
+    // Round to the file's precision first so the reference sees the same inputs
+    if (scalar == BinaryScalar::Float32) {
+        for (std::vector<double> *column : {&x, &y, &theta, &dlead, &p}) {
+            for (double &v : *column) {
+                v = static_cast<float>(v);
+            }
+        }
+    }
+
+    std::string error;
+    StreamOptions options;
+    options.binary = true;
+    options.inputPath = scratchPath("io_checks_poses.cpcb");
+    options.outputPath = scratchPath("io_checks_points.cpcb");
+    CHECK(writeBinaryPoses(options.inputPath, x.data(), y.data(), theta.data(), dlead.data(), p.data(), count,
+                           scalar, param, error));
+    CHECK(runBinary(options) == 0);
+
+    MappedFile out;
+    BinaryPoseHeader header;
+    CHECK(out.openRead(options.outputPath, error) && readBinaryHeader(out, header, error));
+    if (out.data() == nullptr || header.count != count ||
+        header.layout != static_cast<std::uint8_t>(BinaryLayout::Points)) {
+        CHECK(!"output header does not describe the input");
+        return;
+    }
+    const unsigned char *columns = out.data() + sizeof(BinaryPoseHeader);
+    std::size_t columnBytes = count * binaryScalarSize(scalar);
+    for (std::size_t i = 0; i < count; ++i) {
+        Point ref = param == BinaryParam::Radius
+                        ? calculateColinearPoint(x[i], y[i], theta[i], dlead[i], p[i])
+                        : calculateColinearPointWithCurvature(x[i], y[i], theta[i], dlead[i], p[i]);
+        if (scalar == BinaryScalar::Float64) {
+            const double *outX = reinterpret_cast<const double *>(columns);
+            const double *outY = reinterpret_cast<const double *>(columns + columnBytes);
+            CHECK(sameBits(outX[i], ref.x) && sameBits(outY[i], ref.y));
+        } else {
+            const float *outX = reinterpret_cast<const float *>(columns);
+            const float *outY = reinterpret_cast<const float *>(columns + columnBytes);
+            CHECK(outX[i] == static_cast<float>(ref.x) && outY[i] == static_cast<float>(ref.y));
+        }
+    }
+    std::remove(options.inputPath.c_str());
+    std::remove(options.outputPath.c_str());
+}
+
+static void checkBadHeaders() {
+    std::string path = scratchPath("io_checks_bad.cpcb");
+    std::string error;
+    double one = 1.0;
+    CHECK(writeBinaryPoses(path, &one, &one, &one, &one, &one, 1, BinaryScalar::Float64, BinaryParam::Radius,
+                           error));
+    {
+        MappedFile file;
+        BinaryPoseHeader header;
+        CHECK(file.openRead(path, error) && readBinaryHeader(file, header, error));
+    }
+
+    // Claims one row more than the file holds
+    {
+        MappedFile file;
+        BinaryPoseHeader header = makeBinaryHeader(BinaryLayout::Poses, BinaryScalar::Float64,
+                                                   BinaryParam::Radius, 2);
+        CHECK(file.create(path, binaryFileSize(BinaryLayout::Poses, BinaryScalar::Float64, 1), error));
+        std::memcpy(file.data(), &header, sizeof(header));
+    }
+    {
+        MappedFile file;
+        BinaryPoseHeader header;
+        CHECK(file.openRead(path, error) && !readBinaryHeader(file, header, error));
+    }
+
+    // 2^61 + 1 float64 poses of 40 bytes wrap the size product around to 72
+    {
+        MappedFile file;
+        BinaryPoseHeader header = makeBinaryHeader(BinaryLayout::Poses, BinaryScalar::Float64,
+                                                   BinaryParam::Radius, (std::uint64_t(1) << 61) + 1);
+        CHECK(file.create(path, 72, error));
+        std::memcpy(file.data(), &header, sizeof(header));
+    }
+    {
+        MappedFile file;
+        BinaryPoseHeader header;
+        CHECK(file.openRead(path, error) && !readBinaryHeader(file, header, error));
+        StreamOptions options;
+        options.binary = true;
+        options.inputPath = path;
+        options.outputPath = scratchPath("io_checks_bad_out.cpcb");
+        CHECK(runBinary(options) == 1);
+        std::remove(options.outputPath.c_str());
+    }
+
+    // Bad magic
+    {
+        MappedFile file;
+        BinaryPoseHeader header = makeBinaryHeader(BinaryLayout::Poses, BinaryScalar::Float64,
+                                                   BinaryParam::Radius, 0);
+        header.magic[0] = 'X';
+        CHECK(file.create(path, sizeof(header), error));
+        std::memcpy(file.data(), &header, sizeof(header));
+    }
+    {
+        MappedFile file;
+        BinaryPoseHeader header;
+        CHECK(file.openRead(path, error) && !readBinaryHeader(file, header, error));
+    }
+    std::remove(path.c_str());
+}
+
+static void checkSameInputAndOutput() {
+    std::string path = scratchPath("io_checks_same.cpcb");
+    std::string error;
+    double one = 1.0;
+    CHECK(writeBinaryPoses(path, &one, &one, &one, &one, &one, 1, BinaryScalar::Float64, BinaryParam::Radius,
+                           error));
+    StreamOptions options;
+    options.binary = true;
+    options.inputPath = path;
+    options.outputPath = scratchDir.empty() ? "./io_checks_same.cpcb" : scratchDir + "/./io_checks_same.cpcb";
+    CHECK(runBinary(options) == 1);
+    options.outputPath = path;
+    CHECK(runBinary(options) == 1);
+
+    // The input is untouched
+    MappedFile file;
+    BinaryPoseHeader header;
+    CHECK(file.openRead(path, error) && readBinaryHeader(file, header, error) && header.count == 1);
+    file.close();
+    std::remove(path.c_str());
+}
+
+static void checkSweep(BinaryScalar scalar) {
+    SweepSpec spec;
+    spec.x = 1.0;
+    spec.y = -2.0;
+    spec.theta = SweepAxis{-3.0, 0.09, 70};          // crosses a theta block
+    spec.dlead = SweepAxis{-1.0, 0.003, 4100};       // crosses a dlead segment
+    spec.radius = SweepAxis{-2.0, 1.5, 3};
+    std::string path = scratchPath("io_checks_sweep.cpcb");
+    std::string error;
+    WorkStealingPool pool(2);
+    CHECK(writeBinarySweep(path, spec, scalar, &pool, error));
+
+    MappedFile out;
+    BinaryPoseHeader header;
+    CHECK(out.openRead(path, error) && readBinaryHeader(out, header, error));
+    std::uint64_t count = 0;
+    CHECK(sweepPointCount(spec, count));
+    if (out.data() == nullptr || header.count != count) {
+        CHECK(!"sweep header does not match the spec");
+        return;
+    }
+    const unsigned char *columns = out.data() + sizeof(BinaryPoseHeader);
+    std::size_t columnBytes = static_cast<std::size_t>(count) * binaryScalarSize(scalar);
+    // Arcs of at most 11 units on radii of at most 2.5; float32 output is
+    // also off by its own rounding
+    const double tolerance = referenceTolerance(16.0);
+    auto floatTolerance = [tolerance](double reference) {
+        return std::fmax(tolerance, 4.0 * FLT_EPSILON * std::fmax(1.0, std::abs(reference)));
+    };
+    std::size_t i = 0;
+    for (std::size_t t = 0; t < spec.theta.count; ++t) {
+        for (std::size_t r = 0; r < spec.radius.count; ++r) {
+            for (std::size_t d = 0; d < spec.dlead.count; ++d, ++i) {
+                Point ref = calculateColinearPoint(spec.x, spec.y, spec.theta.value(t), spec.dlead.value(d),
+                                                   spec.radius.value(r));
+                if (scalar == BinaryScalar::Float64) {
+                    CHECK_NEAR(reinterpret_cast<const double *>(columns)[i], ref.x, tolerance);
+                    CHECK_NEAR(reinterpret_cast<const double *>(columns + columnBytes)[i], ref.y, tolerance);
+                } else {
+                    CHECK_NEAR(reinterpret_cast<const float *>(columns)[i], ref.x, floatTolerance(ref.x));
+                    CHECK_NEAR(reinterpret_cast<const float *>(columns + columnBytes)[i], ref.y,
+                               floatTolerance(ref.y));
+                }
+            }
+        }
+    }
+    std::remove(path.c_str());
+}
+
+// |dlead| < MIN_DLEAD returns the start pose untouched, even a coordinate
+// that the EPSILON cleanup would have zeroed
+static void checkSweepStayRows() {
+    SweepSpec spec;
+    spec.x = 5e-10;
+    spec.y = -3e-10;
+    spec.theta = SweepAxis{0.3, 0.5, 3};
+    spec.dlead = SweepAxis{-2e-6, 1e-6, 5};          // crosses zero and MIN_DLEAD
+    spec.radius = SweepAxis{1.0, 0.0, 1};
+    std::vector<double> x(15);
+    std::vector<double> y(15);
+    evaluateSweep<double>(nullptr, spec, x.data(), y.data());
+    std::size_t i = 0;
+    for (std::size_t t = 0; t < spec.theta.count; ++t) {
+        for (std::size_t d = 0; d < spec.dlead.count; ++d, ++i) {
+            Point ref = calculateColinearPoint(spec.x, spec.y, spec.theta.value(t), spec.dlead.value(d), 1.0);
+            if (std::abs(spec.dlead.value(d)) < MIN_DLEAD) {
+                CHECK(sameBits(x[i], spec.x) && sameBits(y[i], spec.y));
+                CHECK(sameBits(x[i], ref.x) && sameBits(y[i], ref.y));
+            } else {
+                CHECK_NEAR(x[i], ref.x, referenceTolerance(1.0));
+                CHECK_NEAR(y[i], ref.y, referenceTolerance(1.0));
+            }
+        }
+    }
+}
+
+static void checkOversizedSweeps() {
+    std::string path = scratchPath("io_checks_huge.cpcb");
+    std::string error;
+    std::uint64_t count = 0;
+    SweepSpec spec;
+    spec.theta.count = std::numeric_limits<std::size_t>::max() / 2 + 1;
+    spec.dlead.count = 2;
+    CHECK(!sweepPointCount(spec, count));
+    CHECK(!writeBinarySweep(path, spec, BinaryScalar::Float64, nullptr, error));
+
+    // The product fits, the file size (16 bytes per point) does not
+    spec.theta.count = std::numeric_limits<std::size_t>::max() / 16 + 1;
+    spec.dlead.count = 1;
+    CHECK(sweepPointCount(spec, count) && count == spec.theta.count);
+    CHECK(!writeBinarySweep(path, spec, BinaryScalar::Float64, nullptr, error));
+    std::FILE *created = std::fopen(path.c_str(), "rb");
+    CHECK(created == nullptr);
+    if (created != nullptr) {
+        std::fclose(created);
+        std::remove(path.c_str());
+    }
+}
+
+static void checkArguments() {
+    std::string error;
+    {
+        StreamOptions options;
+        CHECK(parseArgs({"--stream", "--mode", "curvature", "--degrees", "--fast"}, options, error));
+        CHECK(options.mode == StreamMode::Curvature && options.degrees && options.fast);
+    }
+    {
+        StreamOptions options;
+        CHECK(parseArgs({"--sweep", "--theta", "90:90:4", "--dlead", "0:1:2", "--radius", "1:0:1", "--degrees",
+                         "--output", "grid.cpcb"},
+                        options, error));
+        CHECK(options.sweepSpec.theta.count == 4);
+        CHECK(options.sweepSpec.theta.start == degreesToRadians(90.0));
+    }
+    const std::vector<std::vector<const char *>> rejected = {
+        {"--bogus"},
+        {"--mode"},
+        {"--mode", "spiral"},
+        {"--binary", "--input", "poses.cpcb"},
+        {"--binary", "--output", "points.cpcb"},
+        {"--binary", "--input", "poses.cpcb", "--output", "poses.cpcb"},
+        {"--output", "points.cpcb"},
+        {"--sweep", "--output", "grid.cpcb", "--theta", "0:1:0"},
+        {"--sweep", "--output", "grid.cpcb", "--dlead", "0:1:-3"},
+        {"--sweep"},
+        {"--sweep", "--output", "grid.cpcb", "--theta", "0:1:9223372036854775809", "--dlead", "1:1:2",
+         "--radius", "1:0:1"},
+        {"--serve", "a.sock", "--ring", "/ring"},
+        {"--serve", "a.sock", "--input", "poses.txt"},
+    };
+    for (const std::vector<const char *> &args : rejected) {
+        StreamOptions options;
+        error.clear();
+        CHECK(!parseArgs(args, options, error));
+        CHECK(!error.empty());
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) {
+        scratchDir = argv[1];
+    }
+    checkBinaryRoundTrip(BinaryScalar::Float64, BinaryParam::Radius);
+    checkBinaryRoundTrip(BinaryScalar::Float64, BinaryParam::Curvature);
+    checkBinaryRoundTrip(BinaryScalar::Float32, BinaryParam::Radius);
+    checkBadHeaders();
+    checkSameInputAndOutput();
+    checkSweep(BinaryScalar::Float64);
+    checkSweep(BinaryScalar::Float32);
+    checkSweepStayRows();
+    checkOversizedSweeps();
+    checkArguments();
+    return checkExitCode();
+}
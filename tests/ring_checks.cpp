@@ -0,0 +1,122 @@
+// ============================================
+// Shared-Memory Ring Regression Checks
+// ============================================
+// Creates a pose ring segment, serves it from a second thread and checks
+// that ColinearRingClient answers, both one at a time through
+// calculate() and pipelined through trySubmit()/tryReceive(), are
+// bit-identical to calculateColinearPoint(). Also pins open() on a
+// missing and on an undersized segment.
+#include <cmath>
+#include <csignal>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../headerFiLES/ring.hpp"
+#include "checks.hpp"
+
+#if COLINEAR_HAVE_SHM
+
+static RingPose makePose(std::size_t i) {
+    double t = static_cast<double>(i);
+    RingPose pose;
+    pose.x = std::fmod(t * 0.37, 20.0) - 10.0;
+    pose.y = std::fmod(t * 0.71, 20.0) - 10.0;
+    pose.theta = std::fmod(t * 0.013, 12.0) - 6.0;
+    pose.dlead = (i % 11 == 0) ? 0.0 : std::fmod(t * 0.29, 30.0) - 15.0;  // Some stay on the start pose
+    pose.radius = (i % 7 == 0) ? 0.0 : std::fmod(t * 0.17, 8.0) + 0.25;    // Some use the default radius
+    pose.sequence = i;
+    return pose;
+}
+
+static bool sameAsReference(const RingPose &pose, const Point &point) {
+    Point ref = calculateColinearPoint(pose.x, pose.y, pose.theta, pose.dlead, pose.radius);
+    return sameBits(point.x, ref.x) && sameBits(point.y, ref.y);
+}
+
+static void checkCalculate(ColinearRingClient &client) {
+    for (std::size_t i = 0; i < 200; ++i) {
+        RingPose pose = makePose(i);
+        Point point = client.calculate(pose.x, pose.y, pose.theta, pose.dlead, pose.radius);
+        CHECK(sameAsReference(pose, point));
+    }
+}
+
+/**
+ * @brief Keeps up to a full ring of poses in flight; answers come back in order
+ */
+static void checkPipelined(ColinearRingClient &client) {
+    const std::size_t count = 3 * RING_CAPACITY + 17;
+    std::size_t submitted = 0;
+    std::size_t received = 0;
+    RingPose next = makePose(0);
+    while (received < count) {
+        while (submitted < count && submitted - received < RING_CAPACITY && client.trySubmit(next)) {
+            next = makePose(++submitted);
+        }
+        RingPoint answer;
+        while (client.tryReceive(answer)) {
+            CHECK(answer.sequence == received);
+            CHECK(sameAsReference(makePose(received), answer.point));
+            ++received;
+        }
+    }
+    CHECK(submitted == count);
+}
+
+static void checkOpenFailures(const std::string &name) {
+    std::string missing = name + "_missing";
+    ::shm_unlink(missing.c_str());
+    ColinearRingClient client;
+    std::string error;
+    CHECK(!client.open(missing, error));
+    CHECK(error.find("cannot open") != std::string::npos);
+
+    // A segment too small for a ColinearRingSegment is refused before it is mapped
+    std::string small = name + "_small";
+    ::shm_unlink(small.c_str());
+    int fd = ::shm_open(small.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    CHECK(fd >= 0);
+    if (fd < 0) {
+        return;
+    }
+    CHECK(::ftruncate(fd, static_cast<off_t>(sizeof(ColinearRingSegment) / 2)) == 0);
+    ::close(fd);
+    error.clear();
+    CHECK(!client.open(small, error));
+    CHECK(error.find("is not a pose ring") != std::string::npos);
+    ::shm_unlink(small.c_str());
+}
+
+int main() {
+    std::string name = "/colinear_ring_checks_" + std::to_string(static_cast<long>(::getpid()));
+    SharedRingMapping mapping;
+    std::string error;
+    if (!mapping.create(name, error)) {
+        std::fprintf(stderr, "cannot create ring: %s\n", error.c_str());
+        return 1;
+    }
+
+    static volatile std::sig_atomic_t stop = 0;
+    std::thread serving([&mapping] { serveColinearRing(*mapping.segment(), stop); });
+    ColinearRingClient client;
+    CHECK(client.open(name, error));
+    if (checkExitCode() == 0) {
+        checkCalculate(client);
+        checkPipelined(client);
+    }
+    stop = 1;
+    serving.join();
+    checkOpenFailures(name);
+    return checkExitCode();
+}
+
+#else
+
+int main() {
+    std::printf("no POSIX shared memory on this platform; nothing to check\n");
+    return 0;
+}
+
+#endif  // COLINEAR_HAVE_SHM
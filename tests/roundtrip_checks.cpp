@@ -0,0 +1,328 @@
+// ============================================
+// Round-Trip Regression Checks
+// ============================================
+// Pins the modules built on top of calculateColinearPoint() against it
+// or against a brute-force answer:
+//
+// - compile-time route tables: static_asserts on constexpr evaluation;
+// - inverse solvers: the solved dlead / curvature lands back on the
+//   forward point;
+// - PathIndex: nearest() and withinRadius() agree with a linear scan;
+// - arena and ring paths: same points as the sampling functions;
+// - ArcFollower: within a few ULP of the direct evaluation;
+// - Fixed16: conversions, products and sin/cos within one LSB of double.
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+#include "../headerFiLES/fixed16.hpp"
+#include "../headerFiLES/follower.hpp"
+#include "../headerFiLES/inverse.hpp"
+#include "../headerFiLES/spatial.hpp"
+#include "../headerFiLES/trajectory.hpp"
+#include "checks.hpp"
+
+// ============================================
+// Compile-Time Evaluation
+// ============================================
+constexpr bool constexprNear(double a, double b, double tolerance) {
+    return (a > b ? a - b : b - a) <= tolerance;
+}
+
+// A quarter turn on the unit circle ends one radius ahead and one to the left
+constexpr Point QUARTER_TURN = calculateColinearPoint(1.0, 2.0, 0.0, 0.5 * M_PI, 1.0);
+static_assert(constexprNear(QUARTER_TURN.x, 2.0, 1e-15) && constexprNear(QUARTER_TURN.y, 3.0, 1e-15),
+              "constexpr calculateColinearPoint() quarter turn");
+
+// |dlead| < MIN_DLEAD returns the start pose untouched, even below EPSILON
+constexpr Point STAY = calculateColinearPoint(5e-10, -2.0, 0.3, 0.5 * MIN_DLEAD, 1.0);
+static_assert(STAY.x == 5e-10 && STAY.y == -2.0, "constexpr calculateColinearPoint() stay rule");
+
+constexpr RouteWaypoint ROUTE[] = {
+    {0.0, 0.0, 0.0, 1.0, 2.0},                       // (2 sin 0.5, 2 (1 - cos 0.5))
+    {1.0, 1.0, degreesToRadians(90.0), M_PI, 2.0},   // Quarter turn heading +Y: (-1, 3)
+    {-3.0, 2.0, 0.5, 0.0, 1.0},                      // Stays at the start pose
+    {0.0, 0.0, M_PI, 0.5 * M_PI, 0.0},               // Radius 0 falls back to 1: (-1, -1)
+};
+constexpr std::array<Point, 4> ROUTE_TARGETS = makeColinearRoute(ROUTE);
+static_assert(constexprNear(ROUTE_TARGETS[0].x, 0.95885107720840601, 1e-15) &&
+                  constexprNear(ROUTE_TARGETS[0].y, 0.24483487621925443, 1e-15),
+              "route waypoint 0");
+static_assert(constexprNear(ROUTE_TARGETS[1].x, -1.0, 1e-15) && constexprNear(ROUTE_TARGETS[1].y, 3.0, 1e-15),
+              "route waypoint 1");
+static_assert(ROUTE_TARGETS[2].x == -3.0 && ROUTE_TARGETS[2].y == 2.0, "route waypoint 2");
+static_assert(constexprNear(ROUTE_TARGETS[3].x, -1.0, 1e-15) && constexprNear(ROUTE_TARGETS[3].y, -1.0, 1e-15),
+              "route waypoint 3");
+
+/**
+ * @brief Compile-time targets match the runtime backend to a few ULP
+ */
+static void checkRoute() {
+    for (std::size_t i = 0; i < ROUTE_TARGETS.size(); ++i) {
+        const RouteWaypoint &w = ROUTE[i];
+        Point ref = calculateColinearPoint(w.x, w.y, w.theta, w.dlead, w.radius);
+        CHECK_NEAR(ROUTE_TARGETS[i].x, ref.x, referenceTolerance(4.0));
+        CHECK_NEAR(ROUTE_TARGETS[i].y, ref.y, referenceTolerance(4.0));
+    }
+}
+
+// ============================================
+// Inverse Solvers
+// ============================================
+static double distance(const Point &a, const Point &b) {
+    return std::hypot(a.x - b.x, a.y - b.y);
+}
+
+static void checkInverse() {
+    std::mt19937_64 rng(2025);
+    std::uniform_real_distribution<double> pos(-20.0, 20.0);
+    std::uniform_real_distribution<double> ang(-7.0, 7.0);
+    std::uniform_real_distribution<double> rad(0.3, 12.0);
+    std::uniform_real_distribution<double> turn(0.2, 0.95);  // Fraction of half a revolution
+    for (int i = 0; i < 500; ++i) {
+        PoseContext pose = makePoseContext(pos(rng), pos(rng), ang(rng));
+        double radius = rad(rng);
+        double dlead = (i % 2 == 0 ? 1.0 : -1.0) * turn(rng) * M_PI * radius;
+        const double tolerance = referenceTolerance(radius) * std::fmax(1.0, std::abs(pose.x) + std::abs(pose.y));
+
+        // Projection: the point at dlead projects back onto dlead
+        Point target = calculateColinearPoint(pose, dlead, radius);
+        double solved = solveDleadForPoint(pose, radius, target);
+        CHECK(distance(calculateColinearPoint(pose, solved, radius), target) <= tolerance);
+        CHECK_NEAR(solved, dlead, referenceTolerance(radius) * 1e3);
+
+        // Exact arc: the same left circle comes back, the shorter way round.
+        // The target is at least a fifth of a half turn along, so a table
+        // backend's error in it moves the circle by a bounded fraction.
+        const double relative = std::fmax(1e-6, referenceTolerance(8.0));
+        double arcDlead = 0.0;
+        double curvature = 0.0;
+        CHECK(solveArcThroughPoint(pose, target, arcDlead, curvature));
+        CHECK_NEAR(curvature * radius, 1.0, relative);
+        CHECK_NEAR(arcDlead, dlead, relative * radius);
+        Point through = calculateColinearPointWithCurvature(pose.x, pose.y, std::atan2(pose.sinTheta, pose.cosTheta),
+                                                            arcDlead, curvature);
+        CHECK(distance(through, target) <= 1e3 * tolerance);
+    }
+
+    PoseContext pose = makePoseContext(1.0, -2.0, 0.4);
+    double dlead = 0.0;
+    double curvature = 1.0;
+    double radius = 0.0;
+
+    // Straight ahead and straight back: curvature 0, dlead along the heading
+    for (double d : {7.0, -3.0}) {
+        Point target = calculateColinearPointWithCurvature(1.0, -2.0, 0.4, d, 0.0);
+        CHECK(solveArcThroughPoint(pose, target, dlead, curvature));
+        CHECK(curvature == 0.0);
+        CHECK_NEAR(dlead, d, referenceTolerance(std::abs(d)));
+        CHECK(solveRadiusThroughPoint(pose, target, dlead, radius));
+        CHECK(radius == std::numeric_limits<double>::infinity());
+    }
+
+    // Right of the heading line: no left arc reaches it
+    Point right{pose.x + pose.cosTheta + pose.sinTheta, pose.y + pose.sinTheta - pose.cosTheta};
+    CHECK(!solveArcThroughPoint(pose, right, dlead, curvature));
+
+    // Already there
+    CHECK(solveArcThroughPoint(pose, Point{1.0, -2.0}, dlead, curvature));
+    CHECK(dlead == 0.0 && curvature == 0.0);
+}
+
+// ============================================
+// Nearest-Point Queries
+// ============================================
+static void checkPathIndex() {
+    std::mt19937_64 rng(2026);
+    std::uniform_real_distribution<double> pos(-30.0, 30.0);
+    std::vector<Point> points(1500);
+    sampleColinearPointsUniform(makePoseContext(2.0, -1.0, 0.6), -20.0, 0.05, 800, 7.0, points.data());
+    for (std::size_t i = 800; i < points.size(); ++i) {
+        points[i] = Point{pos(rng), pos(rng)};
+    }
+    points[900] = points[901];  // A duplicate, so some queries tie
+    PathIndex index(points.data(), points.size());
+    CHECK(index.size() == points.size());
+
+    std::vector<std::size_t> found;
+    std::vector<std::size_t> expected;
+    for (int q = 0; q < 300; ++q) {
+        Point query = q == 0 ? points[901] : Point{pos(rng), pos(rng)};
+        double bestDistance2 = std::numeric_limits<double>::infinity();
+        for (const Point &p : points) {
+            double dx = p.x - query.x;
+            double dy = p.y - query.y;
+            bestDistance2 = std::min(bestDistance2, dx * dx + dy * dy);
+        }
+        double distance2 = -1.0;
+        std::size_t nearest = index.nearest(query, &distance2);
+        CHECK(nearest < points.size());
+        CHECK(distance2 == bestDistance2);
+        if (nearest < points.size()) {
+            const Point &p = points[nearest];
+            CHECK((p.x - query.x) * (p.x - query.x) + (p.y - query.y) * (p.y - query.y) == bestDistance2);
+        }
+
+        double radius = 0.5 + 0.02 * q;
+        expected.clear();
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            double dx = points[i].x - query.x;
+            double dy = points[i].y - query.y;
+            if (dx * dx + dy * dy <= radius * radius) {
+                expected.push_back(i);
+            }
+        }
+        found.clear();
+        CHECK(index.withinRadius(query, radius, found) == expected.size());
+        std::sort(found.begin(), found.end());
+        CHECK(found == expected);
+    }
+
+    PathIndex empty;
+    CHECK(empty.nearest(Point{0.0, 0.0}) == NO_POINT);
+    CHECK(empty.withinRadius(Point{0.0, 0.0}, 1e9, found) == 0);
+
+    // projectOntoArc() inverts the forward point from outside and inside the circle
+    PoseContext pose = makePoseContext(2.0, -1.0, 0.6);
+    for (double dlead : {-15.0, -2.0, 0.5, 9.0, 19.0}) {
+        Point onArc = calculateColinearPoint(pose, dlead, 7.0);
+        double centerX = pose.x - 7.0 * pose.sinTheta;
+        double centerY = pose.y + 7.0 * pose.cosTheta;
+        for (double scale : {0.8, 1.3}) {
+            Point query{centerX + scale * (onArc.x - centerX), centerY + scale * (onArc.y - centerY)};
+            CHECK_NEAR(projectOntoArc(pose, 7.0, query, -20.0, 20.0), dlead, std::fmax(1e-9, referenceTolerance(7.0)));
+        }
+    }
+}
+
+// ============================================
+// Arena and Ring Paths
+// ============================================
+static void checkTrajectory() {
+    PoseContext pose = makePoseContext(-4.0, 3.0, 2.2);
+    const std::size_t count = 300;
+    std::vector<Point> direct(count);
+    sampleColinearPointsUniform(pose, -6.0, 0.04, count, 3.5, direct.data());
+
+    alignas(Point) unsigned char buffer[(count + 8) * sizeof(Point)];
+    PathArena arena(buffer, sizeof(buffer));
+    PathView path = generatePath(arena, pose, -6.0, 0.04, count, 3.5);
+    CHECK(path.count == count);
+    for (std::size_t i = 0; i < path.count; ++i) {
+        CHECK(sameBits(path[i].x, direct[i].x) && sameBits(path[i].y, direct[i].y));
+    }
+    CHECK(generatePath(arena, pose, -6.0, 0.04, count, 3.5).empty());  // Arena full
+    arena.reset();
+    CHECK(generatePath(arena, pose, -6.0, 0.04, count, 3.5).points == path.points);
+
+    // The ring keeps the last 64 points; across its wrap the sampling
+    // restarts, so compare against the direct evaluation
+    PointRing<64> ring;
+    appendPath(ring, pose, -6.0, 0.04, 40, 3.5);
+    appendPath(ring, pose, -6.0 + 40 * 0.04, 0.04, count - 40, 3.5);
+    CHECK(ring.full());
+    const double tolerance = referenceTolerance(3.5 * static_cast<double>(count));
+    for (std::size_t i = 0; i < ring.size(); ++i) {
+        Point ref = calculateColinearPoint(pose, -6.0 + static_cast<double>(count - 64 + i) * 0.04, 3.5);
+        CHECK_NEAR(ring[i].x, ref.x, tolerance);
+        CHECK_NEAR(ring[i].y, ref.y, tolerance);
+    }
+}
+
+// ============================================
+// Incremental Follower
+// ============================================
+static void checkFollower() {
+    ArcFollower follower;
+    const double radii[] = {4.0, 0.0, -0.5};
+    for (double radius : radii) {
+        PoseContext pose = makePoseContext(10.0, -6.0, -1.1);
+        double r = radius == 0.0 ? DEFAULT_CURVATURE_RADIUS : std::abs(radius);
+        // Resyncs bound the drift to SAMPLE_RESYNC_INTERVAL steps
+        const double tolerance = referenceTolerance(r * SAMPLE_RESYNC_INTERVAL) * (16.0 + r);
+        double dlead = -3.0;
+        for (int tick = 0; tick < 400; ++tick) {
+            // Mostly small steady steps, with jumps and a pass through the start point
+            dlead += tick % 50 == 49 ? 1.3 : (tick < 200 ? 0.01 : 0.0025);
+            Point p = follower.update(pose, dlead, radius);
+            Point ref = calculateColinearPoint(pose, dlead, radius);
+            CHECK_NEAR(p.x, ref.x, tolerance);
+            CHECK_NEAR(p.y, ref.y, tolerance);
+        }
+        Point stay = follower.moveTo(0.0);
+        CHECK(sameBits(stay.x, 10.0) && sameBits(stay.y, -6.0));
+        Point clamped = follower.moveTo(2.0 * MAX_DLEAD);
+        Point ref = calculateColinearPoint(pose, 2.0 * MAX_DLEAD, radius);
+        CHECK(sameBits(clamped.x, ref.x) && sameBits(clamped.y, ref.y));
+    }
+}
+
+// ============================================
+// Q16.16 Fixed Point
+// ============================================
+static void checkFixed16() {
+    const double lsb = 1.0 / Fixed16::ONE;
+    std::mt19937_64 rng(2027);
+    std::uniform_real_distribution<double> value(-150.0, 150.0);
+    for (int i = 0; i < 2000; ++i) {
+        double a = value(rng);
+        double b = value(rng) / 8.0;
+        Fixed16 fa(a);
+        Fixed16 fb(b);
+        CHECK_NEAR(fa.toDouble(), a, 0.5 * lsb);
+        CHECK_NEAR((fa + fb).toDouble(), fa.toDouble() + fb.toDouble(), 0.0);
+        CHECK_NEAR((fa * fb).toDouble(), fa.toDouble() * fb.toDouble(), lsb);
+        if (fb.raw != 0) {
+            CHECK_NEAR((fa / fb).toDouble(), fa.toDouble() / fb.toDouble(), lsb);
+        }
+
+        // sin/cos of the angle as stored
+        Fixed16 angle(a / 10.0);
+        Fixed16 s;
+        Fixed16 c;
+        sinCos(angle, s, c);
+        CHECK_NEAR(s.toDouble(), std::sin(angle.toDouble()), lsb);
+        CHECK_NEAR(c.toDouble(), std::cos(angle.toDouble()), lsb);
+    }
+
+    // Saturation instead of wrap-around
+    CHECK(Fixed16(1e6).raw == std::numeric_limits<std::int32_t>::max());
+    CHECK(Fixed16(-1e6).raw == std::numeric_limits<std::int32_t>::min());
+    CHECK((Fixed16(30000.0) + Fixed16(30000.0)).raw == std::numeric_limits<std::int32_t>::max());
+    CHECK((Fixed16(300.0) * Fixed16(-300.0)).raw == std::numeric_limits<std::int32_t>::min());
+
+    // The whole curve: each of the few products rounds once and sin/cos
+    // are within one LSB, scaled by the radius they multiply (plus the
+    // double reference's own error under a table backend)
+    std::uniform_real_distribution<double> pos(-100.0, 100.0);
+    std::uniform_real_distribution<double> ang(-6.0, 6.0);
+    std::uniform_real_distribution<double> len(-10.0, 10.0);
+    std::uniform_real_distribution<double> rad(0.25, 8.0);
+    for (int i = 0; i < 2000; ++i) {
+        Fixed16 x(pos(rng));
+        Fixed16 y(pos(rng));
+        Fixed16 theta(ang(rng));
+        Fixed16 dlead(len(rng));
+        Fixed16 radius(rad(rng));
+        BasicPoint<Fixed16> p = basicColinearPoint(makeBasicPoseContext<Fixed16>(x, y, theta), dlead, radius);
+        Point ref = calculateColinearPoint(x.toDouble(), y.toDouble(), theta.toDouble(), dlead.toDouble(),
+                                           radius.toDouble());
+        const double tolerance = (4.0 + 4.0 * radius.toDouble()) * lsb + referenceTolerance(radius.toDouble());
+        CHECK_NEAR(p.x.toDouble(), ref.x, tolerance);
+        CHECK_NEAR(p.y.toDouble(), ref.y, tolerance);
+    }
+}
+
+int main() {
+    checkRoute();
+    checkInverse();
+    checkPathIndex();
+    checkTrajectory();
+    checkFollower();
+    checkFixed16();
+    return checkExitCode();
+}
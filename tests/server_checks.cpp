@@ -0,0 +1,157 @@
+// ============================================
+// Socket Server Regression Checks
+// ============================================
+// Runs a ColinearServer on a scratch Unix socket in a second thread and
+// checks that client batches come back bit-identical to the local batch
+// functions, including batches large enough for the thread pool, and
+// that a client which half-closes after its request is still answered.
+// argv[1] is the scratch directory (ctest passes the build directory).
+#include <cmath>
+#include <csignal>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../headerFiLES/server.hpp"
+#include "checks.hpp"
+
+#if COLINEAR_HAVE_UNIX_SOCKETS
+
+static bool sameColumns(const std::vector<double> &a, const std::vector<double> &b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (!sameBits(a[i], b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void checkBatches(const std::string &path) {
+    const std::size_t count = SERVER_PARALLEL_THRESHOLD + 123;
+    std::vector<double> x(count), y(count), theta(count), dlead(count), radius(count), curvature(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        double t = static_cast<double>(i);
+        x[i] = std::fmod(t * 0.37, 20.0) - 10.0;
+        y[i] = std::fmod(t * 0.71, 20.0) - 10.0;
+        theta[i] = std::fmod(t * 0.013, 12.0) - 6.0;
+        dlead[i] = std::fmod(t * 0.11, 30.0) - 5.0;
+        radius[i] = 0.5 + std::fmod(t * 0.29, 10.0);
+        curvature[i] = i % 7 == 0 ? 0.0 : 1.0 / radius[i];
+    }
+
+    std::string error;
+    ColinearClient client;
+    CHECK(client.connect(path, error));
+
+    std::vector<double> outX(count), outY(count), refX(count), refY(count);
+    for (std::size_t n : {std::size_t(1), std::size_t(1000), count}) {
+        outX.assign(n, 0.0);
+        outY.assign(n, 0.0);
+        refX.assign(n, 0.0);
+        refY.assign(n, 0.0);
+        CHECK(client.colinearPointBatch(x.data(), y.data(), theta.data(), dlead.data(), radius.data(), n,
+                                        outX.data(), outY.data()));
+        calculateColinearPointBatch(x.data(), y.data(), theta.data(), dlead.data(), radius.data(), n, refX.data(),
+                                    refY.data());
+        CHECK(sameColumns(outX, refX) && sameColumns(outY, refY));
+
+        CHECK(client.colinearPointBatch(x.data(), y.data(), theta.data(), dlead.data(), radius.data(), n,
+                                        outX.data(), outY.data(), SERVER_FLAG_FAST));
+        calculateColinearPointBatchSimd(x.data(), y.data(), theta.data(), dlead.data(), radius.data(), n,
+                                        refX.data(), refY.data());
+        CHECK(sameColumns(outX, refX) && sameColumns(outY, refY));
+
+        CHECK(client.colinearPointWithCurvatureBatch(x.data(), y.data(), theta.data(), dlead.data(),
+                                                     curvature.data(), n, outX.data(), outY.data()));
+        calculateColinearPointWithCurvatureBatch(x.data(), y.data(), theta.data(), dlead.data(), curvature.data(),
+                                                 n, refX.data(), refY.data());
+        CHECK(sameColumns(outX, refX) && sameColumns(outY, refY));
+    }
+
+    std::vector<double> carrot[4], ref[4];
+    for (int c = 0; c < 4; ++c) {
+        carrot[c].resize(1000);
+        ref[c].resize(1000);
+    }
+    CHECK(client.boomerangCarrotBatch(x.data(), y.data(), theta.data(), dlead.data(), radius.data(), 1000,
+                                      carrot[0].data(), carrot[1].data(), carrot[2].data(), carrot[3].data()));
+    boomerangCarrotBatch(x.data(), y.data(), theta.data(), dlead.data(), radius.data(), 1000, ref[0].data(),
+                         ref[1].data(), ref[2].data(), ref[3].data());
+    for (int c = 0; c < 4; ++c) {
+        CHECK(sameColumns(carrot[c], ref[c]));
+    }
+
+    ServerStats stats;
+    CHECK(client.stats(stats));
+    CHECK(stats.requests == 10);
+    CHECK(stats.rejected == 0);
+    CHECK(stats.clients == 1);
+}
+
+/**
+ * @brief A request sent just before shutdown(SHUT_WR) is still answered
+ *
+ * The client connects and half-closes while the loop is stopped, so the
+ * server's first read returns the frame and its next one the EOF.
+ */
+static void checkHalfClose(ColinearServer &server, const std::string &path, volatile std::sig_atomic_t &stop) {
+    sockaddr_un address;
+    std::string error;
+    CHECK(server_detail::makeSocketAddress(path, address, error));
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    CHECK(fd >= 0 && ::connect(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0);
+
+    double columns[5] = {1.0, -2.0, 0.5, 3.0, 2.0};  // x, y, theta, dlead, radius
+    ServerFrameHeader request = makeServerRequestHeader(ServerRequestKind::Arc, 0, 1, 7);
+    CHECK(server_detail::writeAll(fd, &request, sizeof(request)));
+    CHECK(server_detail::writeAll(fd, columns, sizeof(columns)));
+    ::shutdown(fd, SHUT_WR);
+    stop = 0;
+    std::thread serving([&server, &stop] { server.run(stop, 20); });
+
+    ServerFrameHeader response;
+    double point[2] = {0.0, 0.0};
+    CHECK(server_detail::readAll(fd, &response, sizeof(response)));
+    CHECK(response.kindOrStatus == static_cast<std::uint8_t>(ServerStatus::Ok) && response.requestId == 7);
+    CHECK(server_detail::readAll(fd, point, sizeof(point)));
+    Point ref = calculateColinearPoint(columns[0], columns[1], columns[2], columns[3], columns[4]);
+    CHECK(sameBits(point[0], ref.x) && sameBits(point[1], ref.y));
+    char extra;
+    CHECK(::read(fd, &extra, 1) == 0);  // then the server closes
+    ::close(fd);
+    stop = 1;
+    serving.join();
+}
+
+int main(int argc, char **argv) {
+    std::string path = std::string(argc > 1 ? argv[1] : ".") + "/server_checks.sock";
+    WorkStealingPool pool(2);
+    ServerEngine engine(pool);
+    ColinearServer server(engine);
+    std::string error;
+    if (!server.listen(path, error)) {
+        std::fprintf(stderr, "cannot listen: %s\n", error.c_str());
+        return 1;
+    }
+
+    static volatile std::sig_atomic_t stop = 0;
+    std::thread serving([&server] { server.run(stop, 20); });
+    checkBatches(path);
+    stop = 1;
+    serving.join();
+    checkHalfClose(server, path, stop);
+    return checkExitCode();
+}
+
+#else
+
+int main() {
+    std::printf("no Unix domain sockets on this platform; nothing to check\n");
+    return 0;
+}
+
+#endif  // COLINEAR_HAVE_UNIX_SOCKETS